@@ -39,28 +39,34 @@
 static mma7660fc_handle_t gs_handle;        /**< mma7660fc handle */
 
 /**
- * @brief  basic example init
- * @return status code
- *         - 0 success
- *         - 1 init failed
- * @note   none
+ * @brief     basic example init with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *user_data pointer to the user data passed to the interface
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
  */
-uint8_t mma7660fc_basic_init(void)
+uint8_t mma7660fc_basic_init_with_handle(mma7660fc_handle_t *handle, void *user_data)
 {
     uint8_t res;
+    mma7660fc_config_t config;
+    uint8_t written;
     
     /* link interface function */
-    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
-    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_interface_iic_init);
-    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_interface_iic_deinit);
-    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_interface_iic_read);
-    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_interface_iic_write);
-    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_interface_delay_ms);
-    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
-    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&gs_handle, mma7660fc_interface_receive_callback);
+    DRIVER_MMA7660FC_LINK_INIT(handle, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(handle, mma7660fc_interface_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(handle, mma7660fc_interface_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(handle, mma7660fc_interface_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(handle, mma7660fc_interface_iic_write);
+    DRIVER_MMA7660FC_LINK_IIC_READ_VECTOR(handle, mma7660fc_interface_iic_read_vector);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(handle, mma7660fc_interface_delay_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(handle, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(handle, mma7660fc_interface_receive_callback);
+    DRIVER_MMA7660FC_LINK_USER_DATA(handle, user_data);
     
     /* mma7660fc init */
-    res = mma7660fc_init(&gs_handle);
+    res = mma7660fc_init(handle);
     if (res != 0)
     {
         mma7660fc_interface_debug_print("mma7660fc: init failed.\n");
@@ -68,233 +74,93 @@ uint8_t mma7660fc_basic_init(void)
         return 1;
     }
     
-    /* set sleep count 0 */
-    res = mma7660fc_set_sleep_count(&gs_handle, 0);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set sleep count failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable front back interrupt */
-    res = mma7660fc_set_front_back_interrupt(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set front back interrupt failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable up down right left interrupt */
-    res = mma7660fc_set_up_down_right_left_interrupt(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set up down right left interrupt failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable tap interrupt */
-    res = mma7660fc_set_tap_interrupt(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap interrupt failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable auto sleep interrupt */
-    res = mma7660fc_set_auto_sleep_interrupt(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set auto sleep interrupt failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable update interrupt */
-    res = mma7660fc_set_update_interrupt(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set update interrupt failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable shake x interrupt */
-    res = mma7660fc_set_shake_x_interrupt(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set shake x interrupt failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable shake y interrupt */
-    res = mma7660fc_set_shake_y_interrupt(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set shake y interrupt failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable shake z interrupt */
-    res = mma7660fc_set_shake_z_interrupt(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set shake z interrupt failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable auto wake up */
-    res = mma7660fc_set_auto_wake_up(&gs_handle, MMA7660FC_BOOL_FALSE);
+    /* enable shadow */
+    res = mma7660fc_set_shadow(handle, MMA7660FC_BOOL_TRUE);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set auto wake up failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
+        mma7660fc_interface_debug_print("mma7660fc: set shadow failed.\n");
+       (void)mma7660fc_deinit(handle);
         
         return 1;
     }
     
-    /* disable auto sleep */
-    res = mma7660fc_set_auto_sleep(&gs_handle, MMA7660FC_BOOL_FALSE);
+    /* set default alert retry */
+    res = mma7660fc_set_alert_retry(handle, MMA7660FC_BASIC_DEFAULT_ALERT_RETRY);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set auto sleep failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
+        mma7660fc_interface_debug_print("mma7660fc: set alert retry failed.\n");
+       (void)mma7660fc_deinit(handle);
         
         return 1;
     }
     
-    /* set sleep counter prescaler 1 */
-    res = mma7660fc_set_sleep_counter_prescaler(&gs_handle, MMA7660FC_SLEEP_COUNTER_PRESCALER_1);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set sleep counter prescaler failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set interrupt pin type push pull */
-    res = mma7660fc_set_interrupt_pin_type(&gs_handle, MMA7660FC_INTERRUPT_PIN_TYPE_PUSH_PULL);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set interrupt pin type failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set interrupt active level low */
-    res = mma7660fc_set_interrupt_active_level(&gs_handle, MMA7660FC_INTERRUPT_ACTIVE_LEVEL_LOW);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set interrupt active level failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
+    /* set the basic config */
+    config.sleep_count = 0;                                                        /* set sleep count 0 */
+    config.front_back_interrupt = MMA7660FC_BOOL_FALSE;                            /* disable front back interrupt */
+    config.up_down_right_left_interrupt = MMA7660FC_BOOL_FALSE;                    /* disable up down right left interrupt */
+    config.tap_interrupt = MMA7660FC_BOOL_FALSE;                                   /* disable tap interrupt */
+    config.auto_sleep_interrupt = MMA7660FC_BOOL_FALSE;                            /* disable auto sleep interrupt */
+    config.update_interrupt = MMA7660FC_BOOL_FALSE;                                /* disable update interrupt */
+    config.shake_x_interrupt = MMA7660FC_BOOL_FALSE;                               /* disable shake x interrupt */
+    config.shake_y_interrupt = MMA7660FC_BOOL_FALSE;                               /* disable shake y interrupt */
+    config.shake_z_interrupt = MMA7660FC_BOOL_FALSE;                               /* disable shake z interrupt */
+    config.mode = MMA7660FC_MODE_ACTIVE;                                           /* set mode active */
+    config.auto_wake_up = MMA7660FC_BOOL_FALSE;                                    /* disable auto wake up */
+    config.auto_sleep = MMA7660FC_BOOL_FALSE;                                      /* disable auto sleep */
+    config.sleep_counter_prescaler = MMA7660FC_SLEEP_COUNTER_PRESCALER_1;          /* set sleep counter prescaler 1 */
+    config.interrupt_pin_type = MMA7660FC_INTERRUPT_PIN_TYPE_PUSH_PULL;            /* set interrupt pin type push pull */
+    config.interrupt_active_level = MMA7660FC_INTERRUPT_ACTIVE_LEVEL_LOW;          /* set interrupt active level low */
+    config.tap_detection_rate = MMA7660FC_AUTO_SLEEP_RATE_8;                       /* set tap detection rate 8 */
+    config.auto_wake_rate = MMA7660FC_AUTO_WAKE_RATE_16;                           /* set auto wake rate 16 */
+    config.tilt_debounce_filter = MMA7660FC_TILT_DEBOUNCE_FILTER_2;                /* set tilt debounce filter 2 */
+    config.tap_detection_threshold = 0;                                            /* set tap detection threshold 0 */
+    config.tap_x_detection = MMA7660FC_BOOL_FALSE;                                 /* disable tap x detection */
+    config.tap_y_detection = MMA7660FC_BOOL_FALSE;                                 /* disable tap y detection */
+    config.tap_z_detection = MMA7660FC_BOOL_FALSE;                                 /* disable tap z detection */
+    config.tap_pulse_debounce_count = 0;                                           /* set tap pulse debounce count 0 */
     
-    /* set tap detection rate 8 */
-    res = mma7660fc_set_tap_detection_rate(&gs_handle, MMA7660FC_AUTO_SLEEP_RATE_8);
+    /* sync the changed registers */
+    res = mma7660fc_sync_config(handle, &config, &written);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set tap detection rate failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
+        mma7660fc_interface_debug_print("mma7660fc: sync config failed.\n");
+       (void)mma7660fc_deinit(handle);
         
         return 1;
     }
     
-    /* set auto wake rate 16 */
-    res = mma7660fc_set_auto_wake_rate(&gs_handle, MMA7660FC_AUTO_WAKE_RATE_16);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set auto wake rate failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set tilt debounce filter 2 */
-    res = mma7660fc_set_tilt_debounce_filter(&gs_handle, MMA7660FC_TILT_DEBOUNCE_FILTER_2);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tilt debounce filter failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set tap detection threshold 0 */
-    res = mma7660fc_set_tap_detection_threshold(&gs_handle, 0);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap detection threshold failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable tap x detection */
-    res = mma7660fc_set_tap_x_detection(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap x detection failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable tap y detection */
-    res = mma7660fc_set_tap_y_detection(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap y detection failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* disable tap z detection */
-    res = mma7660fc_set_tap_z_detection(&gs_handle, MMA7660FC_BOOL_FALSE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap z detection failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
-    
-    /* set tap pulse debounce count 0 */
-    res = mma7660fc_set_tap_pulse_debounce_count(&gs_handle, 0);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap pulse debounce count failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
-        return 1;
-    }
+    return 0;
+}
+
+/**
+ * @brief  basic example init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+uint8_t mma7660fc_basic_init(void)
+{
+    return mma7660fc_basic_init_with_handle(&gs_handle, NULL);
+}
+
+/**
+ * @brief      basic example read with a handle
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mma7660fc_basic_read_with_handle(mma7660fc_handle_t *handle, float g[3])
+{
+    uint8_t res;
+    int8_t raw[3];
     
-    /* set mode active */
-    res = mma7660fc_set_mode(&gs_handle, MMA7660FC_MODE_ACTIVE);
+    res = mma7660fc_read(handle, raw, g);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set mode failed.\n");
-       (void)mma7660fc_deinit(&gs_handle);
-        
         return 1;
     }
     
@@ -311,11 +177,21 @@ uint8_t mma7660fc_basic_init(void)
  */
 uint8_t mma7660fc_basic_read(float g[3])
 {
-    uint8_t res;
-    int8_t raw[3];
-    
-    res = mma7660fc_read(&gs_handle, raw, g);
-    if (res != 0)
+    return mma7660fc_basic_read_with_handle(&gs_handle, g);
+}
+
+/**
+ * @brief     basic example deinit with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mma7660fc_basic_deinit_with_handle(mma7660fc_handle_t *handle)
+{
+    /* close mma7660fc */
+    if (mma7660fc_deinit(handle) != 0)
     {
         return 1;
     }
@@ -332,11 +208,5 @@ uint8_t mma7660fc_basic_read(float g[3])
  */
 uint8_t mma7660fc_basic_deinit(void)
 {
-    /* close mma7660fc */
-    if (mma7660fc_deinit(&gs_handle) != 0)
-    {
-        return 1;
-    }
-    
-    return 0;
+    return mma7660fc_basic_deinit_with_handle(&gs_handle);
 }
@@ -50,6 +50,11 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief mma7660fc basic example default definition
+ */
+#define MMA7660FC_BASIC_DEFAULT_ALERT_RETRY        3        /**< retry 3 times */
+
 /**
  * @brief  basic example init
  * @return status code
@@ -59,6 +64,17 @@ extern "C"{
  */
 uint8_t mma7660fc_basic_init(void);
 
+/**
+ * @brief     basic example init with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *user_data pointer to the user data passed to the interface
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mma7660fc_basic_init_with_handle(mma7660fc_handle_t *handle, void *user_data);
+
 /**
  * @brief  basic example deinit
  * @return status code
@@ -68,6 +84,16 @@ uint8_t mma7660fc_basic_init(void);
  */
 uint8_t mma7660fc_basic_deinit(void);
 
+/**
+ * @brief     basic example deinit with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mma7660fc_basic_deinit_with_handle(mma7660fc_handle_t *handle);
+
 /**
  * @brief      basic example read
  * @param[out] *g pointer to a converted data buffer
@@ -78,6 +104,17 @@ uint8_t mma7660fc_basic_deinit(void);
  */
 uint8_t mma7660fc_basic_read(float g[3]);
 
+/**
+ * @brief      basic example read with a handle
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mma7660fc_basic_read_with_handle(mma7660fc_handle_t *handle, float g[3]);
+
 /**
  * @}
  */
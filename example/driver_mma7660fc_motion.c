@@ -38,6 +38,24 @@
 
 static mma7660fc_handle_t gs_handle;        /**< mma7660fc handle */
 
+/**
+ * @brief     motion irq with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+uint8_t mma7660fc_motion_irq_handler_with_handle(mma7660fc_handle_t *handle)
+{
+    if (mma7660fc_irq_handler(handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief  motion irq
  * @return status code
@@ -47,39 +65,41 @@ static mma7660fc_handle_t gs_handle;        /**< mma7660fc handle */
  */
 uint8_t mma7660fc_motion_irq_handler(void)
 {
-    if (mma7660fc_irq_handler(&gs_handle) != 0)
-    {
-        return 1;
-    }
-    
-    return 0;
+    return mma7660fc_motion_irq_handler_with_handle(&gs_handle);
 }
 
 /**
- * @brief     motion example init
+ * @brief     motion example init with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
  * @param[in] *callback pointer to a callback address
+ * @param[in] *user_data pointer to the user data passed to the interface and the callback
  * @return    status code
  *            - 0 success
  *            - 1 init failed
  * @note      none
  */
-uint8_t mma7660fc_motion_init(void (*callback)(uint8_t type))
+uint8_t mma7660fc_motion_init_with_handle(mma7660fc_handle_t *handle, void (*callback)(uint8_t type, void *user_data), void *user_data)
 {
     uint8_t res;
     uint8_t count;
+    mma7660fc_config_t config;
+    uint8_t written;
     
     /* link interface function */
-    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
-    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_interface_iic_init);
-    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_interface_iic_deinit);
-    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_interface_iic_read);
-    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_interface_iic_write);
-    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_interface_delay_ms);
-    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
-    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&gs_handle, callback);
+    DRIVER_MMA7660FC_LINK_INIT(handle, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(handle, mma7660fc_interface_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(handle, mma7660fc_interface_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(handle, mma7660fc_interface_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(handle, mma7660fc_interface_iic_write);
+    DRIVER_MMA7660FC_LINK_IIC_READ_VECTOR(handle, mma7660fc_interface_iic_read_vector);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(handle, mma7660fc_interface_delay_ms);
+    DRIVER_MMA7660FC_LINK_GET_TIME_MS(handle, mma7660fc_interface_get_time_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(handle, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(handle, callback);
+    DRIVER_MMA7660FC_LINK_USER_DATA(handle, user_data);
     
     /* mma7660fc init */
-    res = mma7660fc_init(&gs_handle);
+    res = mma7660fc_init(handle);
     if (res != 0)
     {
         mma7660fc_interface_debug_print("mma7660fc: init failed.\n");
@@ -87,243 +107,134 @@ uint8_t mma7660fc_motion_init(void (*callback)(uint8_t type))
         return 1;
     }
     
-    /* set default front back interrupt */
-    res = mma7660fc_set_front_back_interrupt(&gs_handle, MMA7660FC_MOTION_DEFAULT_FRONT_BACK_INTERRUPT);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set front back interrupt failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default up down right left interrupt */
-    res = mma7660fc_set_up_down_right_left_interrupt(&gs_handle, MMA7660FC_MOTION_DEFAULT_UP_DOWN_RIGHT_LEFT_INTERRUPT);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set up down right left interrupt failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default tap interrupt */
-    res = mma7660fc_set_tap_interrupt(&gs_handle, MMA7660FC_MOTION_DEFAULT_TAP_INTERRUPT);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap interrupt failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default auto sleep interrupt */
-    res = mma7660fc_set_auto_sleep_interrupt(&gs_handle, MMA7660FC_MOTION_DEFAULT_AUTO_SLEEP_INTERRUPT);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set auto sleep interrupt failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default update interrupt */
-    res = mma7660fc_set_update_interrupt(&gs_handle, MMA7660FC_MOTION_DEFAULT_UPDATE_INTERRUPT);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set update interrupt failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default shake x interrupt */
-    res = mma7660fc_set_shake_x_interrupt(&gs_handle, MMA7660FC_MOTION_DEFAULT_SHAKE_X);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set shake x interrupt failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default shake y interrupt */
-    res = mma7660fc_set_shake_y_interrupt(&gs_handle, MMA7660FC_MOTION_DEFAULT_SHAKE_Y);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set shake y interrupt failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default shake z interrupt */
-    res = mma7660fc_set_shake_z_interrupt(&gs_handle, MMA7660FC_MOTION_DEFAULT_SHAKE_Z);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set shake z interrupt failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default sleep counter prescaler */
-    res = mma7660fc_set_sleep_counter_prescaler(&gs_handle, MMA7660FC_MOTION_DEFAULT_SLEEP_COUNTER_PRESCALER);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set sleep counter prescaler failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default tap detection rate */
-    res = mma7660fc_set_tap_detection_rate(&gs_handle, MMA7660FC_MOTION_DEFAULT_AUTO_SLEEP_RATE);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap detection rate failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default auto wake rate */
-    res = mma7660fc_set_auto_wake_rate(&gs_handle, MMA7660FC_MOTION_DEFAULT_AUTO_WAKE_RATE);
+    /* enable shadow */
+    res = mma7660fc_set_shadow(handle, MMA7660FC_BOOL_TRUE);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set auto wake rate failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
+        mma7660fc_interface_debug_print("mma7660fc: set shadow failed.\n");
+        (void)mma7660fc_deinit(handle); 
         
         return 1;
     }
     
-    /* set default sleep count */
-    res = mma7660fc_set_sleep_count(&gs_handle, MMA7660FC_MOTION_DEFAULT_SLEEP_COUNT);
+    /* set default alert retry */
+    res = mma7660fc_set_alert_retry(handle, MMA7660FC_MOTION_DEFAULT_ALERT_RETRY);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set sleep count failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
+        mma7660fc_interface_debug_print("mma7660fc: set alert retry failed.\n");
+        (void)mma7660fc_deinit(handle); 
         
         return 1;
     }
     
-    /* set default auto wake up */
-    res = mma7660fc_set_auto_wake_up(&gs_handle, MMA7660FC_MOTION_DEFAULT_AUTO_WAKE_UP);
+    /* set default shake coalescing */
+    res = mma7660fc_set_coalesce_interval(handle, MMA7660FC_STATUS_SHAKE, MMA7660FC_MOTION_DEFAULT_SHAKE_COALESCE_INTERVAL);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set auto wake up failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
+        mma7660fc_interface_debug_print("mma7660fc: set coalesce interval failed.\n");
+        (void)mma7660fc_deinit(handle); 
         
         return 1;
     }
     
-    /* set default auto sleep */
-    res = mma7660fc_set_auto_sleep(&gs_handle, MMA7660FC_MOTION_DEFAULT_AUTO_SLEEP);
+    /* set default tap coalescing */
+    res = mma7660fc_set_coalesce_interval(handle, MMA7660FC_STATUS_TAP, MMA7660FC_MOTION_DEFAULT_TAP_COALESCE_INTERVAL);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set auto sleep failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
+        mma7660fc_interface_debug_print("mma7660fc: set coalesce interval failed.\n");
+        (void)mma7660fc_deinit(handle); 
         
         return 1;
     }
     
-    /* set default interrupt pin type */
-    res = mma7660fc_set_interrupt_pin_type(&gs_handle, MMA7660FC_MOTION_DEFAULT_INTERRUPT_PIN_TYPE);
+    /* set default coalescing holdoff */
+    res = mma7660fc_set_coalesce_holdoff(handle, MMA7660FC_MOTION_DEFAULT_COALESCE_HOLDOFF);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set interrupt pin type failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
+        mma7660fc_interface_debug_print("mma7660fc: set coalesce holdoff failed.\n");
+        (void)mma7660fc_deinit(handle); 
         
         return 1;
     }
     
-    /* set default interrupt active level */
-    res = mma7660fc_set_interrupt_active_level(&gs_handle, MMA7660FC_MOTION_DEFAULT_INTERRUPT_ACTIVE_LEVEL);
+    /* convert the default tap pulse debounce */
+    res = mma7660fc_tap_pulse_debounce_convert_to_register(handle, MMA7660FC_MOTION_DEFAULT_TAP_PULSE_DEBOUNCE, &count);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set interrupt active level failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default tilt debounce filter */
-    res = mma7660fc_set_tilt_debounce_filter(&gs_handle, MMA7660FC_MOTION_DEFAULT_TILT_DEBOUNCE_FILTER);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tilt debounce filter failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default tap detection threshold */
-    res = mma7660fc_set_tap_detection_threshold(&gs_handle, MMA7660FC_MOTION_DEFAULT_TAP_DETECTION_THRESHOLD);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap detection threshold failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default tap x detection */
-    res = mma7660fc_set_tap_x_detection(&gs_handle, MMA7660FC_MOTION_DEFAULT_TAP_X);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap x detection failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
-    
-    /* set default tap y detection */
-    res = mma7660fc_set_tap_y_detection(&gs_handle, MMA7660FC_MOTION_DEFAULT_TAP_Y);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap y detection failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
+        mma7660fc_interface_debug_print("mma7660fc: tap pulse debounce convert to register failed.\n");
+        (void)mma7660fc_deinit(handle); 
         
         return 1;
     }
     
-    /* set default tap z detection */
-    res = mma7660fc_set_tap_z_detection(&gs_handle, MMA7660FC_MOTION_DEFAULT_TAP_Z);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap z detection failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
+    /* set the default config */
+    config.sleep_count = MMA7660FC_MOTION_DEFAULT_SLEEP_COUNT;
+    config.front_back_interrupt = MMA7660FC_MOTION_DEFAULT_FRONT_BACK_INTERRUPT;
+    config.up_down_right_left_interrupt = MMA7660FC_MOTION_DEFAULT_UP_DOWN_RIGHT_LEFT_INTERRUPT;
+    config.tap_interrupt = MMA7660FC_MOTION_DEFAULT_TAP_INTERRUPT;
+    config.auto_sleep_interrupt = MMA7660FC_MOTION_DEFAULT_AUTO_SLEEP_INTERRUPT;
+    config.update_interrupt = MMA7660FC_MOTION_DEFAULT_UPDATE_INTERRUPT;
+    config.shake_x_interrupt = MMA7660FC_MOTION_DEFAULT_SHAKE_X;
+    config.shake_y_interrupt = MMA7660FC_MOTION_DEFAULT_SHAKE_Y;
+    config.shake_z_interrupt = MMA7660FC_MOTION_DEFAULT_SHAKE_Z;
+    config.mode = MMA7660FC_MODE_ACTIVE;
+    config.auto_wake_up = MMA7660FC_MOTION_DEFAULT_AUTO_WAKE_UP;
+    config.auto_sleep = MMA7660FC_MOTION_DEFAULT_AUTO_SLEEP;
+    config.sleep_counter_prescaler = MMA7660FC_MOTION_DEFAULT_SLEEP_COUNTER_PRESCALER;
+    config.interrupt_pin_type = MMA7660FC_MOTION_DEFAULT_INTERRUPT_PIN_TYPE;
+    config.interrupt_active_level = MMA7660FC_MOTION_DEFAULT_INTERRUPT_ACTIVE_LEVEL;
+    config.tap_detection_rate = MMA7660FC_MOTION_DEFAULT_AUTO_SLEEP_RATE;
+    config.auto_wake_rate = MMA7660FC_MOTION_DEFAULT_AUTO_WAKE_RATE;
+    config.tilt_debounce_filter = MMA7660FC_MOTION_DEFAULT_TILT_DEBOUNCE_FILTER;
+    config.tap_detection_threshold = MMA7660FC_MOTION_DEFAULT_TAP_DETECTION_THRESHOLD;
+    config.tap_x_detection = MMA7660FC_MOTION_DEFAULT_TAP_X;
+    config.tap_y_detection = MMA7660FC_MOTION_DEFAULT_TAP_Y;
+    config.tap_z_detection = MMA7660FC_MOTION_DEFAULT_TAP_Z;
+    config.tap_pulse_debounce_count = count;
     
-    /* set default tap pulse debounce */
-    res = mma7660fc_tap_pulse_debounce_convert_to_register(&gs_handle, MMA7660FC_MOTION_DEFAULT_TAP_PULSE_DEBOUNCE, &count);
+    /* sync the changed registers and set active mode */
+    res = mma7660fc_sync_config(handle, &config, &written);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: tap pulse debounce convert to register failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
+        mma7660fc_interface_debug_print("mma7660fc: sync config failed.\n");
+        (void)mma7660fc_deinit(handle); 
         
         return 1;
     }
     
-    /* set tap pulse debounce count */
-    res = mma7660fc_set_tap_pulse_debounce_count(&gs_handle, count);
-    if (res != 0)
-    {
-        mma7660fc_interface_debug_print("mma7660fc: set tap pulse debounce count failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
-        return 1;
-    }
+    return 0;
+}
+
+/**
+ * @brief     motion example init
+ * @param[in] *callback pointer to a callback address
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mma7660fc_motion_init(void (*callback)(uint8_t type, void *user_data))
+{
+    return mma7660fc_motion_init_with_handle(&gs_handle, callback, NULL);
+}
+
+/**
+ * @brief      motion example read with a handle
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mma7660fc_motion_read_with_handle(mma7660fc_handle_t *handle, float g[3])
+{
+    uint8_t res;
+    int8_t raw[3];
     
-    /* set active mode */
-    res = mma7660fc_set_mode(&gs_handle, MMA7660FC_MODE_ACTIVE);
+    res = mma7660fc_read(handle, raw, g);
     if (res != 0)
     {
-        mma7660fc_interface_debug_print("mma7660fc: set mode failed.\n");
-        (void)mma7660fc_deinit(&gs_handle); 
-        
         return 1;
     }
     
@@ -340,11 +251,21 @@ uint8_t mma7660fc_motion_init(void (*callback)(uint8_t type))
  */
 uint8_t mma7660fc_motion_read(float g[3])
 {
-    uint8_t res;
-    int8_t raw[3];
-    
-    res = mma7660fc_read(&gs_handle, raw, g);
-    if (res != 0)
+    return mma7660fc_motion_read_with_handle(&gs_handle, g);
+}
+
+/**
+ * @brief     motion example deinit with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mma7660fc_motion_deinit_with_handle(mma7660fc_handle_t *handle)
+{
+    /* close mma7660fc */
+    if (mma7660fc_deinit(handle) != 0)
     {
         return 1;
     }
@@ -361,11 +282,5 @@ uint8_t mma7660fc_motion_read(float g[3])
  */
 uint8_t mma7660fc_motion_deinit(void)
 {
-    /* close mma7660fc */
-    if (mma7660fc_deinit(&gs_handle) != 0)
-    {
-        return 1;
-    }
-    
-    return 0;
+    return mma7660fc_motion_deinit_with_handle(&gs_handle);
 }
@@ -73,6 +73,10 @@ extern "C"{
 #define MMA7660FC_MOTION_DEFAULT_TAP_Y                               MMA7660FC_BOOL_TRUE                        /**< enable tap y */
 #define MMA7660FC_MOTION_DEFAULT_TAP_Z                               MMA7660FC_BOOL_TRUE                        /**< enable tap z */
 #define MMA7660FC_MOTION_DEFAULT_TAP_PULSE_DEBOUNCE                  10.0f                                      /**< 10ms */
+#define MMA7660FC_MOTION_DEFAULT_ALERT_RETRY                         3                                          /**< retry 3 times */
+#define MMA7660FC_MOTION_DEFAULT_SHAKE_COALESCE_INTERVAL             500                                        /**< at most one shake event per 500ms */
+#define MMA7660FC_MOTION_DEFAULT_TAP_COALESCE_INTERVAL               0                                          /**< no tap limit */
+#define MMA7660FC_MOTION_DEFAULT_COALESCE_HOLDOFF                    0                                          /**< keep the sources enabled */
 
 /**
  * @brief  motion irq
@@ -83,6 +87,16 @@ extern "C"{
  */
 uint8_t mma7660fc_motion_irq_handler(void);
 
+/**
+ * @brief     motion irq with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+uint8_t mma7660fc_motion_irq_handler_with_handle(mma7660fc_handle_t *handle);
+
 /**
  * @brief     motion example init
  * @param[in] *callback pointer to a callback address
@@ -91,7 +105,19 @@ uint8_t mma7660fc_motion_irq_handler(void);
  *            - 1 init failed
  * @note      none
  */
-uint8_t mma7660fc_motion_init(void (*callback)(uint8_t type));
+uint8_t mma7660fc_motion_init(void (*callback)(uint8_t type, void *user_data));
+
+/**
+ * @brief     motion example init with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *callback pointer to a callback address
+ * @param[in] *user_data pointer to the user data passed to the interface and the callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t mma7660fc_motion_init_with_handle(mma7660fc_handle_t *handle, void (*callback)(uint8_t type, void *user_data), void *user_data);
 
 /**
  * @brief  motion example deinit
@@ -102,6 +128,16 @@ uint8_t mma7660fc_motion_init(void (*callback)(uint8_t type));
  */
 uint8_t mma7660fc_motion_deinit(void);
 
+/**
+ * @brief     motion example deinit with a handle
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t mma7660fc_motion_deinit_with_handle(mma7660fc_handle_t *handle);
+
 /**
  * @brief      motion example read
  * @param[out] *g pointer to a converted data buffer
@@ -112,6 +148,17 @@ uint8_t mma7660fc_motion_deinit(void);
  */
 uint8_t mma7660fc_motion_read(float g[3]);
 
+/**
+ * @brief      motion example read with a handle
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mma7660fc_motion_read_with_handle(mma7660fc_handle_t *handle, float g[3]);
+
 /**
  * @}
  */
@@ -0,0 +1,236 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_update.c
+ * @brief     driver mma7660fc update source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_update.h"
+
+static mma7660fc_handle_t gs_handle;                                                   /**< mma7660fc handle */
+static mma7660fc_ring_t gs_ring;                                                       /**< sample ring */
+static mma7660fc_ring_sample_t gs_ring_buffer[MMA7660FC_UPDATE_DEFAULT_RING_SIZE];     /**< sample ring buffer */
+
+/**
+ * @brief  update irq
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   it reads one sample per update interrupt and pushes it to the ring,
+ *         the sample timestamp is the mma7660fc_interface_get_time_ms time of the interrupt
+ */
+uint8_t mma7660fc_update_irq_handler(void)
+{
+    uint8_t res;
+    uint32_t timestamp;
+    int8_t raw[3];
+    float g[3];
+    mma7660fc_state_t state;
+    mma7660fc_ring_sample_t sample;
+    
+    /* an edge before init has nothing to read */
+    if (gs_handle.inited != 1)
+    {
+        return 1;
+    }
+    
+    /* stamp the interrupt before the bus transfer */
+    timestamp = mma7660fc_interface_get_time_ms();
+    
+    /* the burst includes tilt, so the read also acknowledges the interrupt */
+    res = mma7660fc_read_with_state(&gs_handle, raw, g, &state);
+    if (res != 0)
+    {
+        /* only the irq pushes, so it owns the producer counters */
+        (void)mma7660fc_ring_add_read_error(&gs_ring);
+        
+        return 1;
+    }
+    
+    /* push the sample */
+    sample.timestamp = timestamp;
+    sample.raw[0] = raw[0];
+    sample.raw[1] = raw[1];
+    sample.raw[2] = raw[2];
+    sample.flags = 0;
+    (void)mma7660fc_ring_push(&gs_ring, &sample);
+    
+    return 0;
+}
+
+/**
+ * @brief  update example init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+uint8_t mma7660fc_update_init(void)
+{
+    uint8_t res;
+    mma7660fc_config_t config;
+    uint8_t written;
+    
+    /* link interface function */
+    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_interface_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_interface_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_interface_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_interface_iic_write);
+    DRIVER_MMA7660FC_LINK_IIC_READ_VECTOR(&gs_handle, mma7660fc_interface_iic_read_vector);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_interface_delay_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&gs_handle, mma7660fc_interface_receive_callback);
+    
+    /* ring init */
+    res = mma7660fc_ring_init(&gs_ring, gs_ring_buffer, MMA7660FC_UPDATE_DEFAULT_RING_SIZE);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: ring init failed.\n");
+        
+        return 1;
+    }
+    
+    /* mma7660fc init */
+    res = mma7660fc_init(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* enable shadow */
+    res = mma7660fc_set_shadow(&gs_handle, MMA7660FC_BOOL_TRUE);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set shadow failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    
+    /* set default alert retry */
+    res = mma7660fc_set_alert_retry(&gs_handle, MMA7660FC_UPDATE_DEFAULT_ALERT_RETRY);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set alert retry failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    
+    /* only the update interrupt, no auto sleep so the rate never drops */
+    config.sleep_count = 0;
+    config.front_back_interrupt = MMA7660FC_BOOL_FALSE;
+    config.up_down_right_left_interrupt = MMA7660FC_BOOL_FALSE;
+    config.tap_interrupt = MMA7660FC_BOOL_FALSE;
+    config.auto_sleep_interrupt = MMA7660FC_BOOL_FALSE;
+    config.update_interrupt = MMA7660FC_BOOL_TRUE;
+    config.shake_x_interrupt = MMA7660FC_BOOL_FALSE;
+    config.shake_y_interrupt = MMA7660FC_BOOL_FALSE;
+    config.shake_z_interrupt = MMA7660FC_BOOL_FALSE;
+    config.mode = MMA7660FC_MODE_ACTIVE;
+    config.auto_wake_up = MMA7660FC_BOOL_FALSE;
+    config.auto_sleep = MMA7660FC_BOOL_FALSE;
+    config.sleep_counter_prescaler = MMA7660FC_UPDATE_DEFAULT_SLEEP_COUNTER_PRESCALER;
+    config.interrupt_pin_type = MMA7660FC_UPDATE_DEFAULT_INTERRUPT_PIN_TYPE;
+    config.interrupt_active_level = MMA7660FC_UPDATE_DEFAULT_INTERRUPT_ACTIVE_LEVEL;
+    config.tap_detection_rate = MMA7660FC_UPDATE_DEFAULT_AUTO_SLEEP_RATE;
+    config.auto_wake_rate = MMA7660FC_UPDATE_DEFAULT_AUTO_WAKE_RATE;
+    config.tilt_debounce_filter = MMA7660FC_UPDATE_DEFAULT_TILT_DEBOUNCE_FILTER;
+    config.tap_detection_threshold = 0;
+    config.tap_x_detection = MMA7660FC_BOOL_FALSE;
+    config.tap_y_detection = MMA7660FC_BOOL_FALSE;
+    config.tap_z_detection = MMA7660FC_BOOL_FALSE;
+    config.tap_pulse_debounce_count = 0;
+    
+    /* sync the changed registers and set active mode */
+    res = mma7660fc_sync_config(&gs_handle, &config, &written);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: sync config failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      update example read
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  max max sample number
+ * @return     read sample number
+ * @note       none
+ */
+uint32_t mma7660fc_update_read(mma7660fc_ring_sample_t *sample, uint32_t max)
+{
+    uint32_t num;
+    
+    if (mma7660fc_ring_pop(&gs_ring, sample, max, &num) != 0)
+    {
+        return 0;
+    }
+    
+    return num;
+}
+
+/**
+ * @brief      update example get the counters
+ * @param[out] *overflow pointer to a lost sample counter buffer
+ * @param[out] *read_error pointer to a read error counter buffer
+ * @note       none
+ */
+void mma7660fc_update_get_counter(uint32_t *overflow, uint32_t *read_error)
+{
+    (void)mma7660fc_ring_get_counter(&gs_ring, overflow, read_error);
+}
+
+/**
+ * @brief  update example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t mma7660fc_update_deinit(void)
+{
+    /* close mma7660fc */
+    if (mma7660fc_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_update.h
+ * @brief     driver mma7660fc update header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_UPDATE_H
+#define DRIVER_MMA7660FC_UPDATE_H
+
+#include "driver_mma7660fc_interface.h"
+#include "driver_mma7660fc_ring.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup mma7660fc_example_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc update example default definition
+ */
+#define MMA7660FC_UPDATE_DEFAULT_AUTO_SLEEP_RATE                     MMA7660FC_AUTO_SLEEP_RATE_120              /**< sample rate 120 */
+#define MMA7660FC_UPDATE_DEFAULT_AUTO_WAKE_RATE                      MMA7660FC_AUTO_WAKE_RATE_32                /**< auto wake rate 32 */
+#define MMA7660FC_UPDATE_DEFAULT_SLEEP_COUNTER_PRESCALER             MMA7660FC_SLEEP_COUNTER_PRESCALER_1        /**< sleep counter prescaler 1 */
+#define MMA7660FC_UPDATE_DEFAULT_INTERRUPT_PIN_TYPE                  MMA7660FC_INTERRUPT_PIN_TYPE_PUSH_PULL     /**< push-pull */
+#define MMA7660FC_UPDATE_DEFAULT_INTERRUPT_ACTIVE_LEVEL              MMA7660FC_INTERRUPT_ACTIVE_LEVEL_LOW       /**< low */
+#define MMA7660FC_UPDATE_DEFAULT_TILT_DEBOUNCE_FILTER                MMA7660FC_TILT_DEBOUNCE_FILTER_8           /**< filter 8 */
+#define MMA7660FC_UPDATE_DEFAULT_ALERT_RETRY                         3                                          /**< retry 3 times */
+#define MMA7660FC_UPDATE_DEFAULT_SAMPLE_PERIOD_US                    8333                                       /**< 8333us, 120 samples/second */
+#define MMA7660FC_UPDATE_DEFAULT_RING_SIZE                           256                                        /**< 256 samples, about 2s at 120 samples/second */
+
+/**
+ * @brief  update irq
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   it reads one sample per update interrupt and pushes it to the ring,
+ *         the sample timestamp is the mma7660fc_interface_get_time_ms time of the interrupt
+ */
+uint8_t mma7660fc_update_irq_handler(void);
+
+/**
+ * @brief  update example init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+uint8_t mma7660fc_update_init(void);
+
+/**
+ * @brief  update example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t mma7660fc_update_deinit(void);
+
+/**
+ * @brief      update example read
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  max max sample number
+ * @return     read sample number
+ * @note       none
+ */
+uint32_t mma7660fc_update_read(mma7660fc_ring_sample_t *sample, uint32_t max);
+
+/**
+ * @brief      update example get the counters
+ * @param[out] *overflow pointer to a lost sample counter buffer
+ * @param[out] *read_error pointer to a read error counter buffer
+ * @note       none
+ */
+void mma7660fc_update_get_counter(uint32_t *overflow, uint32_t *read_error);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -51,22 +51,24 @@ extern "C"{
  */
 
 /**
- * @brief  interface iic bus init
- * @return status code
- *         - 0 success
- *         - 1 iic init failed
- * @note   none
+ * @brief     interface iic bus init
+ * @param[in] *user_data pointer to the user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
  */
-uint8_t mma7660fc_interface_iic_init(void);
+uint8_t mma7660fc_interface_iic_init(void *user_data);
 
 /**
- * @brief  interface iic bus deinit
- * @return status code
- *         - 0 success
- *         - 1 iic deinit failed
- * @note   none
+ * @brief     interface iic bus deinit
+ * @param[in] *user_data pointer to the user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
  */
-uint8_t mma7660fc_interface_iic_deinit(void);
+uint8_t mma7660fc_interface_iic_deinit(void *user_data);
 
 /**
  * @brief      interface iic bus read
@@ -74,12 +76,13 @@ uint8_t mma7660fc_interface_iic_deinit(void);
  * @param[in]  reg iic register address
  * @param[out] *buf pointer to a data buffer
  * @param[in]  len length of the data buffer
+ * @param[in]  *user_data pointer to the user data
  * @return     status code
  *             - 0 success
  *             - 1 read failed
  * @note       none
  */
-uint8_t mma7660fc_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+uint8_t mma7660fc_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data);
 
 /**
  * @brief     interface iic bus write
@@ -87,12 +90,42 @@ uint8_t mma7660fc_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, ui
  * @param[in] reg iic register address
  * @param[in] *buf pointer to a data buffer
  * @param[in] len length of the data buffer
+ * @param[in] *user_data pointer to the user data
  * @return    status code
  *            - 0 success
  *            - 1 write failed
  * @note      none
  */
-uint8_t mma7660fc_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+uint8_t mma7660fc_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data);
+
+/**
+ * @brief      interface iic bus vectored read
+ * @param[in]  *vector pointer to an iic vector buffer
+ * @param[in]  num vector number
+ * @param[in]  *user_data pointer to the user data
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mma7660fc_interface_iic_read_vector(mma7660fc_iic_vector_t *vector, uint16_t num, void *user_data);
+
+/**
+ * @brief      interface iic bus split-phase read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function address
+ * @param[in]  *context pointer to the completion context
+ * @param[in]  *user_data pointer to the user data
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       done(context, status) must be called once the transfer is finished
+ */
+uint8_t mma7660fc_interface_iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                           void (*done)(void *context, uint8_t status), void *context, void *user_data);
 
 /**
  * @brief     interface delay ms
@@ -101,6 +134,13 @@ uint8_t mma7660fc_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, u
  */
 void mma7660fc_interface_delay_ms(uint32_t ms);
 
+/**
+ * @brief  interface get time ms
+ * @return monotonic time in ms
+ * @note   optional, it is used by the interrupt coalescing
+ */
+uint32_t mma7660fc_interface_get_time_ms(void);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -111,9 +151,10 @@ void mma7660fc_interface_debug_print(const char *const fmt, ...);
 /**
  * @brief     interface receive callback
  * @param[in] type irq type
+ * @param[in] *user_data pointer to the user data
  * @note      none
  */
-void mma7660fc_interface_receive_callback(uint8_t type);
+void mma7660fc_interface_receive_callback(uint8_t type, void *user_data);
 
 /**
  * @}
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mma7660fc_interface.h
+ * @brief     raspberrypi4b driver mma7660fc interface header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MMA7660FC_INTERFACE_H
+#define RASPBERRYPI4B_DRIVER_MMA7660FC_INTERFACE_H
+
+#include "driver_mma7660fc_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mma7660fc_raspberrypi4b_interface mma7660fc raspberrypi4b interface function
+ * @brief    mma7660fc raspberrypi4b interface modules
+ * @ingroup  mma7660fc_interface_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc raspberrypi4b interface context structure definition
+ * @note  link a pointer to this structure as the handle user data,
+ *        a NULL user data uses the default iic device
+ */
+typedef struct mma7660fc_interface_context_s
+{
+    char *name;        /**< iic device name, such as "/dev/i2c-1" */
+    int fd;            /**< iic device handle */
+} mma7660fc_interface_context_t;
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mma7660fc_poller.h
+ * @brief     raspberrypi4b driver mma7660fc poller header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RASPBERRYPI4B_DRIVER_MMA7660FC_POLLER_H
+#define RASPBERRYPI4B_DRIVER_MMA7660FC_POLLER_H
+
+#include "driver_mma7660fc.h"
+#include <pthread.h>
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mma7660fc_raspberrypi4b_poller mma7660fc raspberrypi4b poller function
+ * @brief    mma7660fc raspberrypi4b multi-sensor poller modules
+ * @ingroup  mma7660fc_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc poller max bus definition
+ */
+#ifndef MMA7660FC_POLLER_MAX_BUS
+    #define MMA7660FC_POLLER_MAX_BUS        8        /**< max 8 iic buses */
+#endif
+
+/**
+ * @brief mma7660fc poller max batch definition
+ */
+#ifndef MMA7660FC_POLLER_MAX_BATCH
+    #define MMA7660FC_POLLER_MAX_BATCH        16        /**< max 16 sensors per vectored read */
+#endif
+
+/**
+ * @brief mma7660fc poller sample structure definition
+ */
+typedef struct mma7660fc_poller_sample_s
+{
+    uint64_t timestamp_us;        /**< monotonic timestamp in us */
+    int8_t raw[3];                /**< raw data */
+    float g[3];                   /**< converted data */
+} mma7660fc_poller_sample_t;
+
+/**
+ * @brief mma7660fc poller sensor structure definition
+ */
+typedef struct mma7660fc_poller_sensor_s
+{
+    mma7660fc_handle_t *handle;                      /**< initialized mma7660fc handle */
+    uint32_t period_ms;                              /**< read period in ms */
+    uint64_t next_us;                                /**< next read time in us */
+    mma7660fc_poller_sample_t *queue;                /**< sample queue buffer */
+    uint32_t queue_size;                             /**< sample queue size */
+    uint32_t head;                                   /**< queue write index */
+    uint32_t count;                                  /**< queued sample count */
+    uint32_t dropped;                                /**< dropped sample counter */
+    uint32_t error;                                  /**< read error counter */
+    pthread_mutex_t mutex;                           /**< queue mutex */
+    struct mma7660fc_poller_sensor_s *next;          /**< next sensor on the same bus */
+} mma7660fc_poller_sensor_t;
+
+/**
+ * @brief mma7660fc poller bus structure definition
+ */
+typedef struct mma7660fc_poller_bus_s
+{
+    struct mma7660fc_poller_s *poller;        /**< owner poller */
+    const char *name;                         /**< iic bus name */
+    dev_t dev;                                /**< resolved iic bus device */
+    mma7660fc_poller_sensor_t *sensor;        /**< sensor list */
+    pthread_t thread;                         /**< worker thread */
+} mma7660fc_poller_bus_t;
+
+/**
+ * @brief mma7660fc poller structure definition
+ */
+typedef struct mma7660fc_poller_s
+{
+    mma7660fc_poller_bus_t bus[MMA7660FC_POLLER_MAX_BUS];        /**< bus table */
+    uint8_t bus_num;                                             /**< used bus number */
+    uint8_t running;                                             /**< running flag */
+    pthread_mutex_t mutex;                                       /**< poller mutex */
+    pthread_cond_t cond;                                         /**< stop condition */
+} mma7660fc_poller_t;
+
+/**
+ * @brief     init the poller
+ * @param[in] *poller pointer to a poller structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 poller is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_poller_init(mma7660fc_poller_t *poller);
+
+/**
+ * @brief     add a sensor to the poller
+ * @param[in] *poller pointer to a poller structure
+ * @param[in] *sensor pointer to a sensor structure
+ * @param[in] *handle pointer to an initialized mma7660fc handle structure
+ * @param[in] *bus pointer to an iic bus name
+ * @param[in] period_ms read period in ms
+ * @param[in] *queue pointer to a sample queue buffer
+ * @param[in] queue_size sample queue size
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ *            - 2 poller is NULL
+ *            - 3 poller is running
+ *            - 4 param is invalid
+ *            - 5 too many buses
+ *            - 6 bus is not an iic device
+ * @note      the bus name is resolved to its device, so all sensors on the same device are
+ *            read by one worker thread even when their bus names differ,
+ *            the sensor, the handle, the bus name and the queue must stay valid until deinit
+ */
+uint8_t mma7660fc_poller_add_sensor(mma7660fc_poller_t *poller, mma7660fc_poller_sensor_t *sensor,
+                                    mma7660fc_handle_t *handle, const char *bus, uint32_t period_ms,
+                                    mma7660fc_poller_sample_t *queue, uint32_t queue_size);
+
+/**
+ * @brief     start the poller
+ * @param[in] *poller pointer to a poller structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 poller is NULL
+ *            - 3 poller is running
+ * @note      one worker thread is created for each iic bus
+ */
+uint8_t mma7660fc_poller_start(mma7660fc_poller_t *poller);
+
+/**
+ * @brief     stop the poller
+ * @param[in] *poller pointer to a poller structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ *            - 2 poller is NULL
+ *            - 3 poller is not running
+ * @note      none
+ */
+uint8_t mma7660fc_poller_stop(mma7660fc_poller_t *poller);
+
+/**
+ * @brief     deinit the poller
+ * @param[in] *poller pointer to a poller structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 poller is NULL
+ *            - 3 poller is running
+ * @note      none
+ */
+uint8_t mma7660fc_poller_deinit(mma7660fc_poller_t *poller);
+
+/**
+ * @brief      pop the oldest sample of a sensor
+ * @param[in]  *sensor pointer to a sensor structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 queue is empty
+ *             - 2 sensor is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_poller_pop(mma7660fc_poller_sensor_t *sensor, mma7660fc_poller_sample_t *sample);
+
+/**
+ * @brief      get the sensor counters
+ * @param[in]  *sensor pointer to a sensor structure
+ * @param[out] *dropped pointer to a dropped sample counter buffer
+ * @param[out] *error pointer to a read error counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sensor is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_poller_get_counter(mma7660fc_poller_sensor_t *sensor, uint32_t *dropped, uint32_t *error);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
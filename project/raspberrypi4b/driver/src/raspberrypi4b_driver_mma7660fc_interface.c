@@ -34,9 +34,11 @@
  * </table>
  */
 
-#include "driver_mma7660fc_interface.h"
+#include "raspberrypi4b_driver_mma7660fc_interface.h"
 #include "iic.h"
 #include <stdarg.h>
+#include <time.h>
+#include <pthread.h>
 
 /**
  * @brief iic device name definition
@@ -44,32 +46,83 @@
 #define IIC_DEVICE_NAME "/dev/i2c-1"        /**< iic device name */
 
 /**
- * @brief iic device handle definition
+ * @brief split-phase read queue size definition
  */
-static int gs_fd;                       /**< iic handle */
+#define IIC_ASYNC_QUEUE_SIZE 8        /**< max 8 pending reads */
 
 /**
- * @brief  interface iic bus init
- * @return status code
- *         - 0 success
- *         - 1 iic init failed
- * @note   none
+ * @brief split-phase read request structure definition
  */
-uint8_t mma7660fc_interface_iic_init(void)
+typedef struct a_interface_async_s
 {
-    return iic_init(IIC_DEVICE_NAME, &gs_fd);
+    int fd;                                           /**< iic device handle */
+    uint8_t addr;                                     /**< iic device address */
+    uint8_t reg;                                      /**< iic register address */
+    uint8_t *buf;                                     /**< data buffer */
+    uint16_t len;                                     /**< data length */
+    void (*done)(void *context, uint8_t status);      /**< completion function */
+    void *context;                                    /**< completion context */
+} a_interface_async_t;
+
+/**
+ * @brief default iic context definition
+ */
+static mma7660fc_interface_context_t gs_context =        /**< default iic context */
+{
+    .name = IIC_DEVICE_NAME,
+    .fd = -1,
+};
+
+static pthread_once_t gs_async_once = PTHREAD_ONCE_INIT;                 /**< worker start once */
+static pthread_mutex_t gs_async_mutex = PTHREAD_MUTEX_INITIALIZER;       /**< request queue mutex */
+static pthread_cond_t gs_async_cond = PTHREAD_COND_INITIALIZER;          /**< request queue condition */
+static a_interface_async_t gs_async_queue[IIC_ASYNC_QUEUE_SIZE];         /**< request queue */
+static uint8_t gs_async_head;                                            /**< request queue read index */
+static uint8_t gs_async_count;                                           /**< queued request count */
+static uint8_t gs_async_started;                                         /**< worker started flag */
+
+/**
+ * @brief     get the iic context
+ * @param[in] *user_data pointer to the user data
+ * @return    pointer to the iic context
+ * @note      none
+ */
+static mma7660fc_interface_context_t *a_interface_context(void *user_data)
+{
+    if (user_data == NULL)                                          /* no user data */
+    {
+        return &gs_context;                                         /* use the default context */
+    }
+    
+    return (mma7660fc_interface_context_t *)user_data;              /* use the user context */
 }
 
 /**
- * @brief  interface iic bus deinit
- * @return status code
- *         - 0 success
- *         - 1 iic deinit failed
- * @note   none
+ * @brief     interface iic bus init
+ * @param[in] *user_data pointer to the user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
  */
-uint8_t mma7660fc_interface_iic_deinit(void)
+uint8_t mma7660fc_interface_iic_init(void *user_data)
 {
-    return iic_deinit(gs_fd);
+    mma7660fc_interface_context_t *context = a_interface_context(user_data);
+    
+    return iic_init(context->name, &context->fd);
+}
+
+/**
+ * @brief     interface iic bus deinit
+ * @param[in] *user_data pointer to the user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t mma7660fc_interface_iic_deinit(void *user_data)
+{
+    return iic_deinit(a_interface_context(user_data)->fd);
 }
 
 /**
@@ -78,14 +131,15 @@ uint8_t mma7660fc_interface_iic_deinit(void)
  * @param[in]  reg iic register address
  * @param[out] *buf pointer to a data buffer
  * @param[in]  len length of the data buffer
+ * @param[in]  *user_data pointer to the user data
  * @return     status code
  *             - 0 success
  *             - 1 read failed
  * @note       none
  */
-uint8_t mma7660fc_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+uint8_t mma7660fc_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data)
 {
-    return iic_read(gs_fd, addr, reg, buf, len);
+    return iic_read(a_interface_context(user_data)->fd, addr, reg, buf, len);
 }
 
 /**
@@ -94,14 +148,147 @@ uint8_t mma7660fc_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, ui
  * @param[in] reg iic register address
  * @param[in] *buf pointer to a data buffer
  * @param[in] len length of the data buffer
+ * @param[in] *user_data pointer to the user data
  * @return    status code
  *            - 0 success
  *            - 1 write failed
  * @note      none
  */
-uint8_t mma7660fc_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+uint8_t mma7660fc_interface_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data)
+{
+    return iic_write(a_interface_context(user_data)->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus vectored read
+ * @param[in]  *vector pointer to an iic vector buffer
+ * @param[in]  num vector number
+ * @param[in]  *user_data pointer to the user data
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mma7660fc_interface_iic_read_vector(mma7660fc_iic_vector_t *vector, uint16_t num, void *user_data)
+{
+    iic_read_vector_t batch[IIC_READ_BATCH_MAX];
+    uint16_t i;
+    uint16_t n;
+    
+    while (num != 0)
+    {
+        n = (num > IIC_READ_BATCH_MAX) ? IIC_READ_BATCH_MAX : num;
+        for (i = 0; i < n; i++)
+        {
+            batch[i].addr = vector[i].addr;
+            batch[i].reg = vector[i].reg;
+            batch[i].buf = vector[i].buf;
+            batch[i].len = vector[i].len;
+        }
+        if (iic_read_batch(a_interface_context(user_data)->fd, batch, n) != 0)
+        {
+            return 1;
+        }
+        vector += n;
+        num -= n;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  split-phase read worker pthread
+ * @param  *p unused
+ * @return NULL
+ * @note   the transfer runs here and done is called from this thread
+ */
+static void *a_interface_async_pthread(void *p)
+{
+    a_interface_async_t request;
+    uint8_t status;
+    
+    (void)p;
+    while (1)
+    {
+        (void)pthread_mutex_lock(&gs_async_mutex);
+        while (gs_async_count == 0)                                                    /* wait for a request */
+        {
+            (void)pthread_cond_wait(&gs_async_cond, &gs_async_mutex);
+        }
+        request = gs_async_queue[gs_async_head];                                       /* take the oldest request */
+        gs_async_head = (uint8_t)((gs_async_head + 1) % IIC_ASYNC_QUEUE_SIZE);         /* next position */
+        gs_async_count--;                                                              /* count-- */
+        (void)pthread_mutex_unlock(&gs_async_mutex);
+        
+        status = iic_read(request.fd, request.addr, request.reg, request.buf, request.len);
+        __sync_synchronize();                                                          /* publish the data before done */
+        request.done(request.context, status);                                         /* complete the request */
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief start the split-phase read worker
+ * @note  none
+ */
+static void a_interface_async_start(void)
 {
-    return iic_write(gs_fd, addr, reg, buf, len);
+    pthread_t thread;
+    
+    if (pthread_create(&thread, NULL, a_interface_async_pthread, NULL) == 0)          /* create the worker */
+    {
+        (void)pthread_detach(thread);                                                  /* never joined */
+        gs_async_started = 1;                                                          /* flag started */
+    }
+}
+
+/**
+ * @brief      interface iic bus split-phase read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function address
+ * @param[in]  *context pointer to the completion context
+ * @param[in]  *user_data pointer to the user data
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       the request is queued to a worker thread which runs the transfer
+ *             and calls done(context, status) once it is finished
+ */
+uint8_t mma7660fc_interface_iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                           void (*done)(void *context, uint8_t status), void *context, void *user_data)
+{
+    a_interface_async_t *request;
+    
+    (void)pthread_once(&gs_async_once, a_interface_async_start);                       /* start the worker once */
+    if (gs_async_started == 0)                                                         /* check the worker */
+    {
+        return 1;
+    }
+    
+    (void)pthread_mutex_lock(&gs_async_mutex);
+    if (gs_async_count >= IIC_ASYNC_QUEUE_SIZE)                                        /* check full */
+    {
+        (void)pthread_mutex_unlock(&gs_async_mutex);
+        
+        return 1;
+    }
+    request = &gs_async_queue[(gs_async_head + gs_async_count) % IIC_ASYNC_QUEUE_SIZE];
+    request->fd = a_interface_context(user_data)->fd;
+    request->addr = addr;
+    request->reg = reg;
+    request->buf = buf;
+    request->len = len;
+    request->done = done;
+    request->context = context;
+    gs_async_count++;                                                                  /* count++ */
+    (void)pthread_cond_signal(&gs_async_cond);                                         /* wake up the worker */
+    (void)pthread_mutex_unlock(&gs_async_mutex);
+    
+    return 0;
 }
 
 /**
@@ -114,6 +301,20 @@ void mma7660fc_interface_delay_ms(uint32_t ms)
     usleep(ms * 1000);
 }
 
+/**
+ * @brief  interface get time ms
+ * @return monotonic time in ms
+ * @note   optional, it is used by the interrupt coalescing
+ */
+uint32_t mma7660fc_interface_get_time_ms(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + (uint64_t)(ts.tv_nsec / 1000000));
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -137,9 +338,10 @@ void mma7660fc_interface_debug_print(const char *const fmt, ...)
 /**
  * @brief     interface receive callback
  * @param[in] type irq type
+ * @param[in] *user_data pointer to the user data
  * @note      none
  */
-void mma7660fc_interface_receive_callback(uint8_t type)
+void mma7660fc_interface_receive_callback(uint8_t type, void *user_data)
 {
     switch (type)
     {
@@ -0,0 +1,584 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      raspberrypi4b_driver_mma7660fc_poller.c
+ * @brief     raspberrypi4b driver mma7660fc poller source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "raspberrypi4b_driver_mma7660fc_poller.h"
+#include "driver_mma7660fc_batch.h"
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+
+/**
+ * @brief poller read definition
+ */
+#define POLLER_MMA7660FC_ADDRESS        0x98        /**< iic device address */
+#define POLLER_MMA7660FC_REG_XOUT       0x00        /**< xout register */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_poller_time_us(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+/**
+ * @brief     push a sample into the sensor queue
+ * @param[in] *sensor pointer to a sensor structure
+ * @param[in] *sample pointer to a sample structure
+ * @note      the oldest sample is dropped when the queue is full
+ */
+static void a_poller_push(mma7660fc_poller_sensor_t *sensor, const mma7660fc_poller_sample_t *sample)
+{
+    (void)pthread_mutex_lock(&sensor->mutex);
+    sensor->queue[sensor->head] = *sample;                           /* copy the sample */
+    sensor->head = (sensor->head + 1) % sensor->queue_size;          /* next position */
+    if (sensor->count < sensor->queue_size)                          /* not full */
+    {
+        sensor->count++;                                             /* count++ */
+    }
+    else
+    {
+        sensor->dropped++;                                           /* overwrite the oldest */
+    }
+    (void)pthread_mutex_unlock(&sensor->mutex);
+}
+
+/**
+ * @brief     advance the sensor schedule
+ * @param[in] *sensor pointer to a sensor structure
+ * @param[in] now current time in us
+ * @note      none
+ */
+static void a_poller_next_slot(mma7660fc_poller_sensor_t *sensor, uint64_t now)
+{
+    sensor->next_us += (uint64_t)sensor->period_ms * 1000ULL;                 /* next slot */
+    if (sensor->next_us <= now)                                               /* behind schedule */
+    {
+        sensor->next_us = now + (uint64_t)sensor->period_ms * 1000ULL;        /* skip the missed slots */
+    }
+}
+
+/**
+ * @brief     read one sensor with the driver read path
+ * @param[in] *sensor pointer to a sensor structure
+ * @note      used when the vectored read is not linked, for alert samples and for calibrated handles
+ */
+static void a_poller_read_single(mma7660fc_poller_sensor_t *sensor)
+{
+    mma7660fc_poller_sample_t sample;
+    
+    if (mma7660fc_read(sensor->handle, sample.raw, sample.g) != 0)            /* read data */
+    {
+        (void)pthread_mutex_lock(&sensor->mutex);
+        sensor->error++;                                                      /* error++ */
+        (void)pthread_mutex_unlock(&sensor->mutex);
+    }
+    else
+    {
+        sample.timestamp_us = a_poller_time_us();                             /* stamp the sample */
+        a_poller_push(sensor, &sample);                                       /* push the sample */
+    }
+}
+
+/**
+ * @brief     read a group of due sensors in one vectored read
+ * @param[in] **sensor pointer to a due sensor table
+ * @param[in] num sensor number
+ * @note      all sensors share one bus device, so the first handle issues the transfer
+ */
+static void a_poller_read_batch(mma7660fc_poller_sensor_t **sensor, uint16_t num)
+{
+    mma7660fc_iic_vector_t vector[MMA7660FC_POLLER_MAX_BATCH];
+    uint8_t buf[MMA7660FC_POLLER_MAX_BATCH * 3];
+    int8_t raw[MMA7660FC_POLLER_MAX_BATCH * 3];
+    float g[MMA7660FC_POLLER_MAX_BATCH * 3];
+    uint8_t valid[MMA7660FC_POLLER_MAX_BATCH];
+    mma7660fc_poller_sample_t sample;
+    mma7660fc_handle_t *handle = sensor[0]->handle;
+    uint64_t timestamp;
+    uint16_t i;
+    
+    if (handle->iic_read_vector == NULL)                                      /* no vectored read */
+    {
+        for (i = 0; i < num; i++)
+        {
+            a_poller_read_single(sensor[i]);                                  /* read one by one */
+        }
+        
+        return;
+    }
+    
+    for (i = 0; i < num; i++)
+    {
+        vector[i].addr = POLLER_MMA7660FC_ADDRESS;                            /* set the address */
+        vector[i].reg = POLLER_MMA7660FC_REG_XOUT;                            /* set the register */
+        vector[i].buf = &buf[i * 3];                                          /* set the buffer */
+        vector[i].len = 3;                                                    /* xout to zout */
+    }
+    if (handle->iic_read_vector(vector, num, handle->user_data) != 0)         /* read all sensors */
+    {
+        for (i = 0; i < num; i++)
+        {
+            (void)pthread_mutex_lock(&sensor[i]->mutex);
+            sensor[i]->error++;                                               /* error++ */
+            (void)pthread_mutex_unlock(&sensor[i]->mutex);
+        }
+        
+        return;
+    }
+    timestamp = a_poller_time_us();                                           /* one stamp for the transfer */
+    (void)mma7660fc_decode_batch(buf, num, raw, g, NULL, valid);              /* decode all samples */
+    for (i = 0; i < num; i++)
+    {
+        if ((valid[i] == 0) || (sensor[i]->handle->calibration_enable != 0))  /* alert or calibrated */
+        {
+            a_poller_read_single(sensor[i]);                                  /* use the driver read path */
+            
+            continue;
+        }
+        sample.timestamp_us = timestamp;                                      /* stamp the sample */
+        sample.raw[0] = raw[i * 3 + 0];                                       /* copy x */
+        sample.raw[1] = raw[i * 3 + 1];                                       /* copy y */
+        sample.raw[2] = raw[i * 3 + 2];                                       /* copy z */
+        sample.g[0] = g[i * 3 + 0];                                           /* copy x */
+        sample.g[1] = g[i * 3 + 1];                                           /* copy y */
+        sample.g[2] = g[i * 3 + 2];                                           /* copy z */
+        a_poller_push(sensor[i], &sample);                                    /* push the sample */
+    }
+}
+
+/**
+ * @brief     read all due sensors of a bus
+ * @param[in] *bus pointer to a bus structure
+ * @param[in] now current time in us
+ * @note      due sensors are read in vectored reads of up to MMA7660FC_POLLER_MAX_BATCH sensors
+ */
+static void a_poller_read_bus(mma7660fc_poller_bus_t *bus, uint64_t now)
+{
+    mma7660fc_poller_sensor_t *due[MMA7660FC_POLLER_MAX_BATCH];
+    mma7660fc_poller_sensor_t *sensor;
+    uint16_t num;
+    
+    num = 0;
+    for (sensor = bus->sensor; sensor != NULL; sensor = sensor->next)
+    {
+        if (sensor->next_us > now)                                            /* not due */
+        {
+            continue;                                                         /* skip */
+        }
+        due[num] = sensor;                                                    /* collect the sensor */
+        num++;                                                                /* num++ */
+        a_poller_next_slot(sensor, now);                                      /* advance the schedule */
+        if (num == MMA7660FC_POLLER_MAX_BATCH)                                /* batch is full */
+        {
+            a_poller_read_batch(due, num);                                    /* read the batch */
+            num = 0;                                                          /* start a new batch */
+        }
+    }
+    if (num != 0)                                                             /* remaining sensors */
+    {
+        a_poller_read_batch(due, num);                                        /* read the batch */
+    }
+}
+
+/**
+ * @brief  bus worker pthread
+ * @param  *p pointer to a bus structure
+ * @return NULL
+ * @note   none
+ */
+static void *a_poller_pthread(void *p)
+{
+    mma7660fc_poller_bus_t *bus = (mma7660fc_poller_bus_t *)p;
+    mma7660fc_poller_t *poller = bus->poller;
+    mma7660fc_poller_sensor_t *sensor;
+    uint64_t now;
+    uint64_t deadline;
+    struct timespec ts;
+    
+    now = a_poller_time_us();
+    for (sensor = bus->sensor; sensor != NULL; sensor = sensor->next)
+    {
+        sensor->next_us = now;                                                /* read at once */
+    }
+    
+    (void)pthread_mutex_lock(&poller->mutex);
+    while (poller->running != 0)
+    {
+        deadline = UINT64_MAX;
+        for (sensor = bus->sensor; sensor != NULL; sensor = sensor->next)
+        {
+            if (sensor->next_us < deadline)                                   /* find the nearest slot */
+            {
+                deadline = sensor->next_us;
+            }
+        }
+        now = a_poller_time_us();
+        if (deadline > now)                                                   /* wait for the slot or stop */
+        {
+            ts.tv_sec = (time_t)(deadline / 1000000ULL);
+            ts.tv_nsec = (long)((deadline % 1000000ULL) * 1000ULL);
+            (void)pthread_cond_timedwait(&poller->cond, &poller->mutex, &ts);
+            
+            continue;
+        }
+        (void)pthread_mutex_unlock(&poller->mutex);
+        a_poller_read_bus(bus, now);                                          /* read without the lock */
+        (void)pthread_mutex_lock(&poller->mutex);
+    }
+    (void)pthread_mutex_unlock(&poller->mutex);
+    
+    return NULL;
+}
+
+/**
+ * @brief     init the poller
+ * @param[in] *poller pointer to a poller structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ *            - 2 poller is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_poller_init(mma7660fc_poller_t *poller)
+{
+    pthread_condattr_t attr;
+    
+    if (poller == NULL)                                                       /* check poller */
+    {
+        return 2;                                                             /* return error */
+    }
+    
+    memset(poller, 0, sizeof(mma7660fc_poller_t));                           /* clear the poller */
+    if (pthread_mutex_init(&poller->mutex, NULL) != 0)                        /* init the mutex */
+    {
+        return 1;                                                             /* return error */
+    }
+    if (pthread_condattr_init(&attr) != 0)                                    /* init the condition attr */
+    {
+        (void)pthread_mutex_destroy(&poller->mutex);
+        
+        return 1;                                                             /* return error */
+    }
+    if ((pthread_condattr_setclock(&attr, CLOCK_MONOTONIC) != 0) ||           /* wait on the monotonic clock */
+        (pthread_cond_init(&poller->cond, &attr) != 0))                       /* init the condition */
+    {
+        (void)pthread_condattr_destroy(&attr);
+        (void)pthread_mutex_destroy(&poller->mutex);
+        
+        return 1;                                                             /* return error */
+    }
+    (void)pthread_condattr_destroy(&attr);
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     add a sensor to the poller
+ * @param[in] *poller pointer to a poller structure
+ * @param[in] *sensor pointer to a sensor structure
+ * @param[in] *handle pointer to an initialized mma7660fc handle structure
+ * @param[in] *bus pointer to an iic bus name
+ * @param[in] period_ms read period in ms
+ * @param[in] *queue pointer to a sample queue buffer
+ * @param[in] queue_size sample queue size
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ *            - 2 poller is NULL
+ *            - 3 poller is running
+ *            - 4 param is invalid
+ *            - 5 too many buses
+ *            - 6 bus is not an iic device
+ * @note      the bus name is resolved to its device, so all sensors on the same device are
+ *            read by one worker thread even when their bus names differ,
+ *            the sensor, the handle, the bus name and the queue must stay valid until deinit
+ */
+uint8_t mma7660fc_poller_add_sensor(mma7660fc_poller_t *poller, mma7660fc_poller_sensor_t *sensor,
+                                    mma7660fc_handle_t *handle, const char *bus, uint32_t period_ms,
+                                    mma7660fc_poller_sample_t *queue, uint32_t queue_size)
+{
+    uint8_t i;
+    struct stat st;
+    mma7660fc_poller_sensor_t **tail;
+    
+    if (poller == NULL)                                                       /* check poller */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (poller->running != 0)                                                 /* check running */
+    {
+        return 3;                                                             /* return error */
+    }
+    if ((sensor == NULL) || (handle == NULL) || (bus == NULL) ||
+        (period_ms == 0) || (queue == NULL) || (queue_size == 0))             /* check params */
+    {
+        return 4;                                                             /* return error */
+    }
+    
+    if (stat(bus, &st) != 0)                                                  /* resolve the bus */
+    {
+        return 1;                                                             /* return error */
+    }
+    if (S_ISCHR(st.st_mode) == 0)                                             /* check the device type */
+    {
+        return 6;                                                             /* return error */
+    }
+    for (i = 0; i < poller->bus_num; i++)                                     /* find the bus */
+    {
+        if (poller->bus[i].dev == st.st_rdev)                                 /* same device */
+        {
+            break;
+        }
+    }
+    if (i == poller->bus_num)                                                 /* new bus */
+    {
+        if (poller->bus_num >= MMA7660FC_POLLER_MAX_BUS)                      /* check the bus table */
+        {
+            return 5;                                                         /* return error */
+        }
+        poller->bus[i].poller = poller;                                       /* set the owner */
+        poller->bus[i].name = bus;                                            /* set the name */
+        poller->bus[i].dev = st.st_rdev;                                      /* set the device */
+        poller->bus[i].sensor = NULL;                                         /* empty list */
+        poller->bus_num++;                                                    /* bus_num++ */
+    }
+    
+    memset(sensor, 0, sizeof(mma7660fc_poller_sensor_t));                    /* clear the sensor */
+    if (pthread_mutex_init(&sensor->mutex, NULL) != 0)                        /* init the mutex */
+    {
+        return 1;                                                             /* return error */
+    }
+    sensor->handle = handle;                                                  /* set the handle */
+    sensor->period_ms = period_ms;                                            /* set the period */
+    sensor->queue = queue;                                                    /* set the queue */
+    sensor->queue_size = queue_size;                                          /* set the queue size */
+    for (tail = &poller->bus[i].sensor; *tail != NULL; tail = &(*tail)->next)
+    {
+        /* find the list tail */
+    }
+    *tail = sensor;                                                           /* append the sensor */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     start the poller
+ * @param[in] *poller pointer to a poller structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 poller is NULL
+ *            - 3 poller is running
+ * @note      one worker thread is created for each iic bus
+ */
+uint8_t mma7660fc_poller_start(mma7660fc_poller_t *poller)
+{
+    uint8_t i;
+    uint8_t j;
+    
+    if (poller == NULL)                                                       /* check poller */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (poller->running != 0)                                                 /* check running */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    poller->running = 1;                                                      /* set running */
+    for (i = 0; i < poller->bus_num; i++)
+    {
+        if (pthread_create(&poller->bus[i].thread, NULL, 
+                           a_poller_pthread, &poller->bus[i]) != 0)           /* create the bus worker */
+        {
+            (void)pthread_mutex_lock(&poller->mutex);
+            poller->running = 0;                                              /* stop the created workers */
+            (void)pthread_cond_broadcast(&poller->cond);
+            (void)pthread_mutex_unlock(&poller->mutex);
+            for (j = 0; j < i; j++)
+            {
+                (void)pthread_join(poller->bus[j].thread, NULL);              /* wait the worker */
+            }
+            
+            return 1;                                                         /* return error */
+        }
+    }
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     stop the poller
+ * @param[in] *poller pointer to a poller structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ *            - 2 poller is NULL
+ *            - 3 poller is not running
+ * @note      none
+ */
+uint8_t mma7660fc_poller_stop(mma7660fc_poller_t *poller)
+{
+    uint8_t i;
+    uint8_t res;
+    
+    if (poller == NULL)                                                       /* check poller */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (poller->running == 0)                                                 /* check running */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    (void)pthread_mutex_lock(&poller->mutex);
+    poller->running = 0;                                                      /* clear running */
+    (void)pthread_cond_broadcast(&poller->cond);                              /* wake up all workers */
+    (void)pthread_mutex_unlock(&poller->mutex);
+    res = 0;
+    for (i = 0; i < poller->bus_num; i++)
+    {
+        if (pthread_join(poller->bus[i].thread, NULL) != 0)                   /* wait the worker */
+        {
+            res = 1;                                                          /* flag error */
+        }
+    }
+    
+    return res;                                                               /* return the result */
+}
+
+/**
+ * @brief     deinit the poller
+ * @param[in] *poller pointer to a poller structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 poller is NULL
+ *            - 3 poller is running
+ * @note      none
+ */
+uint8_t mma7660fc_poller_deinit(mma7660fc_poller_t *poller)
+{
+    uint8_t i;
+    mma7660fc_poller_sensor_t *sensor;
+    
+    if (poller == NULL)                                                       /* check poller */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (poller->running != 0)                                                 /* check running */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    for (i = 0; i < poller->bus_num; i++)
+    {
+        for (sensor = poller->bus[i].sensor; sensor != NULL; sensor = sensor->next)
+        {
+            (void)pthread_mutex_destroy(&sensor->mutex);                      /* destroy the sensor mutex */
+        }
+    }
+    (void)pthread_cond_destroy(&poller->cond);                                /* destroy the condition */
+    (void)pthread_mutex_destroy(&poller->mutex);                              /* destroy the mutex */
+    poller->bus_num = 0;                                                      /* clear the bus table */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      pop the oldest sample of a sensor
+ * @param[in]  *sensor pointer to a sensor structure
+ * @param[out] *sample pointer to a sample buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 queue is empty
+ *             - 2 sensor is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_poller_pop(mma7660fc_poller_sensor_t *sensor, mma7660fc_poller_sample_t *sample)
+{
+    uint32_t tail;
+    
+    if ((sensor == NULL) || (sample == NULL))                                 /* check sensor */
+    {
+        return 2;                                                             /* return error */
+    }
+    
+    (void)pthread_mutex_lock(&sensor->mutex);
+    if (sensor->count == 0)                                                   /* check empty */
+    {
+        (void)pthread_mutex_unlock(&sensor->mutex);
+        
+        return 1;                                                             /* return error */
+    }
+    tail = (sensor->head + sensor->queue_size - sensor->count) % sensor->queue_size;        /* oldest position */
+    *sample = sensor->queue[tail];                                            /* copy the sample */
+    sensor->count--;                                                          /* count-- */
+    (void)pthread_mutex_unlock(&sensor->mutex);
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      get the sensor counters
+ * @param[in]  *sensor pointer to a sensor structure
+ * @param[out] *dropped pointer to a dropped sample counter buffer
+ * @param[out] *error pointer to a read error counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sensor is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_poller_get_counter(mma7660fc_poller_sensor_t *sensor, uint32_t *dropped, uint32_t *error)
+{
+    if ((sensor == NULL) || (dropped == NULL) || (error == NULL))             /* check sensor */
+    {
+        return 2;                                                             /* return error */
+    }
+    
+    (void)pthread_mutex_lock(&sensor->mutex);
+    *dropped = sensor->dropped;                                               /* get the dropped counter */
+    *error = sensor->error;                                                   /* get the error counter */
+    (void)pthread_mutex_unlock(&sensor->mutex);
+    
+    return 0;                                                                 /* success return 0 */
+}
@@ -0,0 +1,183 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      event_loop.h
+ * @brief     event loop header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup event_loop event loop function
+ * @brief    event loop function modules
+ * @{
+ */
+
+/**
+ * @brief libgpiod handle declaration
+ */
+struct gpiod_chip;
+struct gpiod_line;
+
+/**
+ * @brief event loop max source definition
+ */
+#define EVENT_LOOP_MAX_SOURCE 16        /**< max gpio lines and timers of one loop */
+
+/**
+ * @brief event loop edge batch definition
+ */
+#define EVENT_LOOP_EDGE_BATCH 16        /**< max gpio edges read per wakeup */
+
+/**
+ * @brief event loop source type enumeration definition
+ */
+typedef enum
+{
+    EVENT_LOOP_SOURCE_GPIO  = 0x00,        /**< gpio falling edge */
+    EVENT_LOOP_SOURCE_TIMER = 0x01,        /**< periodic timer */
+} event_loop_source_type_t;
+
+/**
+ * @brief event loop source structure definition
+ */
+typedef struct event_loop_source_s
+{
+    event_loop_source_type_t type;                                                        /**< source type */
+    int fd;                                                                               /**< watched fd */
+    struct gpiod_chip *chip;                                                              /**< gpio chip handle */
+    struct gpiod_line *line;                                                              /**< gpio line handle */
+    void (*callback)(const struct timespec *ts, uint32_t count, void *user_data);         /**< source callback */
+    void *user_data;                                                                      /**< user data passed to the callback */
+} event_loop_source_t;
+
+/**
+ * @brief event loop structure definition
+ */
+typedef struct event_loop_s
+{
+    int epoll_fd;                                         /**< epoll fd */
+    int event_fd;                                         /**< shutdown eventfd */
+    pthread_t pid;                                        /**< loop pthread pid */
+    uint8_t running;                                      /**< running flag */
+    uint8_t source_num;                                   /**< source number */
+    event_loop_source_t source[EVENT_LOOP_MAX_SOURCE];    /**< source table */
+} event_loop_t;
+
+/**
+ * @brief     event loop init
+ * @param[in] *loop pointer to an event loop structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t event_loop_init(event_loop_t *loop);
+
+/**
+ * @brief     event loop add a gpio line
+ * @param[in] *loop pointer to an event loop structure
+ * @param[in] *chip_name pointer to a gpio chip path
+ * @param[in] line gpio line offset
+ * @param[in] *callback pointer to a callback, ts is the first kernel edge timestamp and
+ *                      count is the edges drained in one wakeup
+ * @param[in] *user_data pointer to the user data passed to the callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      sources must be added before event_loop_start
+ */
+uint8_t event_loop_add_gpio(event_loop_t *loop, const char *chip_name, uint32_t line,
+                            void (*callback)(const struct timespec *ts, uint32_t count, void *user_data), void *user_data);
+
+/**
+ * @brief     event loop add a periodic timer
+ * @param[in] *loop pointer to an event loop structure
+ * @param[in] period_ms timer period in ms
+ * @param[in] *callback pointer to a callback, count is the expirations since the last call
+ * @param[in] *user_data pointer to the user data passed to the callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      sources must be added before event_loop_start
+ */
+uint8_t event_loop_add_timer(event_loop_t *loop, uint32_t period_ms,
+                             void (*callback)(const struct timespec *ts, uint32_t count, void *user_data), void *user_data);
+
+/**
+ * @brief     event loop start
+ * @param[in] *loop pointer to an event loop structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      all the callbacks run on one loop pthread
+ */
+uint8_t event_loop_start(event_loop_t *loop);
+
+/**
+ * @brief     event loop stop
+ * @param[in] *loop pointer to an event loop structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      it wakes the loop through the eventfd and waits until no callback is running
+ */
+uint8_t event_loop_stop(event_loop_t *loop);
+
+/**
+ * @brief     event loop deinit
+ * @param[in] *loop pointer to an event loop structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      it stops the loop if running and releases all the sources
+ */
+uint8_t event_loop_deinit(event_loop_t *loop);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -51,12 +51,27 @@
  * @{
  */
 
+/**
+ * @brief gpio interrupt statistics structure definition
+ */
+typedef struct gpio_interrupt_statistics_s
+{
+    uint32_t edge;                  /**< captured edges */
+    uint32_t handled;               /**< g_gpio_irq calls */
+    uint32_t merged;                /**< edges merged into an earlier edge's g_gpio_irq call */
+    uint32_t max_merged;            /**< max edges of one g_gpio_irq call */
+    uint32_t lost;                  /**< edges lost on a full queue */
+    uint32_t depth;                 /**< queued edges now */
+    uint32_t max_depth;             /**< max queued edges */
+    uint32_t max_latency_us;        /**< max time from the edge to the callback start */
+} gpio_interrupt_statistics_t;
+
 /**
  * @brief  gpio interrupt init
  * @return status code
  *         - 0 success
  *         - 1 init failed
- * @note   none
+ * @note   the event loop only queues the kernel timestamp, g_gpio_irq runs on a worker pthread
  */
 uint8_t gpio_interrupt_init(void);
 
@@ -69,6 +84,34 @@ uint8_t gpio_interrupt_init(void);
  */
 uint8_t gpio_interrupt_deinit(void);
 
+/**
+ * @brief     gpio simulated interrupt init
+ * @param[in] period_ms interrupt period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      it queues an edge periodically without a gpio line, g_gpio_irq runs on the same worker,
+ *            gpio_interrupt_deinit stops it
+ */
+uint8_t gpio_interrupt_simulate_init(uint32_t period_ms);
+
+/**
+ * @brief  gpio interrupt get the edge count
+ * @return edges merged into the running g_gpio_irq call
+ * @note   only valid inside g_gpio_irq
+ */
+uint32_t gpio_interrupt_get_edge_count(void);
+
+/**
+ * @brief      gpio interrupt get the statistics
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t gpio_interrupt_get_statistics(gpio_interrupt_statistics_t *statistics);
+
 /**
  * @}
  */
@@ -53,6 +53,23 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief iic read batch max definition
+ * @note  I2C_RDWR accepts at most 42 messages and each read takes two messages
+ */
+#define IIC_READ_BATCH_MAX        21        /**< max 21 reads */
+
+/**
+ * @brief iic read vector structure definition
+ */
+typedef struct iic_read_vector_s
+{
+    uint8_t addr;         /**< iic device write address */
+    uint8_t reg;          /**< iic register address */
+    uint8_t *buf;         /**< pointer to a data buffer */
+    uint16_t len;         /**< length of the data buffer */
+} iic_read_vector_t;
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -101,6 +118,19 @@ uint8_t iic_read_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len);
  */
 uint8_t iic_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief         iic bus batch read
+ * @param[in]     fd iic handle
+ * @param[in,out] *vector pointer to a read vector buffer
+ * @param[in]     num vector number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          addr = device_address_7bits << 1,
+ *                every IIC_READ_BATCH_MAX reads are packed into one I2C_RDWR transfer
+ */
+uint8_t iic_read_batch(int fd, iic_read_vector_t *vector, uint16_t num);
+
 /**
  * @brief      iic bus read with 16 bits register address
  * @param[in]  fd iic handle
@@ -0,0 +1,442 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      event_loop.c
+ * @brief     event loop source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "event_loop.h"
+#include <gpiod.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+
+/**
+ * @brief     event loop dispatch one source
+ * @param[in] *source pointer to a source structure
+ * @note      none
+ */
+static void a_event_loop_dispatch(event_loop_source_t *source)
+{
+    int num;
+    uint64_t expiration;
+    struct timespec ts;
+    struct gpiod_line_event event[EVENT_LOOP_EDGE_BATCH];
+    
+    if (source->type == EVENT_LOOP_SOURCE_GPIO)
+    {
+        /* drain the pending edges in one read, only falling edges are requested */
+        num = gpiod_line_event_read_multiple(source->line, event, EVENT_LOOP_EDGE_BATCH);
+        if (num <= 0)
+        {
+            return;
+        }
+        
+        /* a full batch leaves the fd readable, so the next wakeup gets the rest */
+        source->callback(&event[0].ts, (uint32_t)num, source->user_data);
+    }
+    else
+    {
+        /* read the expirations */
+        if (read(source->fd, &expiration, sizeof(uint64_t)) != (ssize_t)sizeof(uint64_t))
+        {
+            return;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        source->callback(&ts, (uint32_t)expiration, source->user_data);
+    }
+}
+
+/**
+ * @brief  event loop pthread
+ * @param  *p pointer to an event loop structure
+ * @return NULL
+ * @note   none
+ */
+static void *a_event_loop_pthread(void *p)
+{
+    int i;
+    int num;
+    event_loop_t *loop = (event_loop_t *)p;
+    struct epoll_event events[EVENT_LOOP_MAX_SOURCE + 1];
+    
+    /* loop */
+    while (1)
+    {
+        /* sleep until a source or the shutdown eventfd is ready */
+        num = epoll_wait(loop->epoll_fd, events, EVENT_LOOP_MAX_SOURCE + 1, -1);
+        if (num < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("event loop: epoll wait failed.\n");
+            
+            break;
+        }
+        
+        /* the shutdown eventfd has no source */
+        for (i = 0; i < num; i++)
+        {
+            if (events[i].data.ptr == NULL)
+            {
+                return NULL;
+            }
+        }
+        
+        /* run the callbacks */
+        for (i = 0; i < num; i++)
+        {
+            a_event_loop_dispatch((event_loop_source_t *)events[i].data.ptr);
+        }
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief     event loop watch a source fd
+ * @param[in] *loop pointer to an event loop structure
+ * @param[in] *source pointer to a source structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 watch failed
+ * @note      none
+ */
+static uint8_t a_event_loop_watch(event_loop_t *loop, event_loop_source_t *source)
+{
+    struct epoll_event event;
+    
+    memset(&event, 0, sizeof(struct epoll_event));
+    event.events = EPOLLIN;
+    event.data.ptr = source;
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, source->fd, &event) != 0)
+    {
+        perror("event loop: epoll add failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     event loop init
+ * @param[in] *loop pointer to an event loop structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t event_loop_init(event_loop_t *loop)
+{
+    struct epoll_event event;
+    
+    if (loop == NULL)
+    {
+        return 1;
+    }
+    memset(loop, 0, sizeof(event_loop_t));
+    
+    /* creat the epoll */
+    loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (loop->epoll_fd < 0)
+    {
+        perror("event loop: epoll create failed.\n");
+        
+        return 1;
+    }
+    
+    /* creat the shutdown eventfd */
+    loop->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (loop->event_fd < 0)
+    {
+        perror("event loop: eventfd create failed.\n");
+        (void)close(loop->epoll_fd);
+        
+        return 1;
+    }
+    memset(&event, 0, sizeof(struct epoll_event));
+    event.events = EPOLLIN;
+    event.data.ptr = NULL;
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->event_fd, &event) != 0)
+    {
+        perror("event loop: epoll add failed.\n");
+        (void)close(loop->event_fd);
+        (void)close(loop->epoll_fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     event loop add a gpio line
+ * @param[in] *loop pointer to an event loop structure
+ * @param[in] *chip_name pointer to a gpio chip path
+ * @param[in] line gpio line offset
+ * @param[in] *callback pointer to a callback, ts is the first kernel edge timestamp and
+ *                      count is the edges drained in one wakeup
+ * @param[in] *user_data pointer to the user data passed to the callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      sources must be added before event_loop_start
+ */
+uint8_t event_loop_add_gpio(event_loop_t *loop, const char *chip_name, uint32_t line,
+                            void (*callback)(const struct timespec *ts, uint32_t count, void *user_data), void *user_data)
+{
+    event_loop_source_t *source;
+    
+    if ((loop == NULL) || (chip_name == NULL) || (callback == NULL) ||
+        (loop->running != 0) || (loop->source_num >= EVENT_LOOP_MAX_SOURCE))
+    {
+        return 1;
+    }
+    source = &loop->source[loop->source_num];
+    
+    /* open the gpio group */
+    source->chip = gpiod_chip_open(chip_name);
+    if (source->chip == NULL)
+    {
+        perror("event loop: gpio open failed.\n");
+        
+        return 1;
+    }
+    
+    /* get the gpio line */
+    source->line = gpiod_chip_get_line(source->chip, line);
+    if (source->line == NULL)
+    {
+        perror("event loop: gpio get line failed.\n");
+        gpiod_chip_close(source->chip);
+        
+        return 1;
+    }
+    
+    /* catch the falling edge */
+    if (gpiod_line_request_falling_edge_events(source->line, "gpiointerrupt") < 0)
+    {
+        perror("event loop: gpio set edge events failed.\n");
+        gpiod_chip_close(source->chip);
+        
+        return 1;
+    }
+    
+    /* watch the line fd */
+    source->type = EVENT_LOOP_SOURCE_GPIO;
+    source->fd = gpiod_line_event_get_fd(source->line);
+    source->callback = callback;
+    source->user_data = user_data;
+    if ((source->fd < 0) || (a_event_loop_watch(loop, source) != 0))
+    {
+        gpiod_line_release(source->line);
+        gpiod_chip_close(source->chip);
+        
+        return 1;
+    }
+    loop->source_num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     event loop add a periodic timer
+ * @param[in] *loop pointer to an event loop structure
+ * @param[in] period_ms timer period in ms
+ * @param[in] *callback pointer to a callback, count is the expirations since the last call
+ * @param[in] *user_data pointer to the user data passed to the callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      sources must be added before event_loop_start
+ */
+uint8_t event_loop_add_timer(event_loop_t *loop, uint32_t period_ms,
+                             void (*callback)(const struct timespec *ts, uint32_t count, void *user_data), void *user_data)
+{
+    struct itimerspec spec;
+    event_loop_source_t *source;
+    
+    if ((loop == NULL) || (period_ms == 0) || (callback == NULL) ||
+        (loop->running != 0) || (loop->source_num >= EVENT_LOOP_MAX_SOURCE))
+    {
+        return 1;
+    }
+    source = &loop->source[loop->source_num];
+    
+    /* creat the timer */
+    source->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (source->fd < 0)
+    {
+        perror("event loop: timerfd create failed.\n");
+        
+        return 1;
+    }
+    
+    /* periodic, the kernel keeps the phase so there is no drift */
+    spec.it_interval.tv_sec = period_ms / 1000;
+    spec.it_interval.tv_nsec = (long)(period_ms % 1000) * 1000000L;
+    spec.it_value = spec.it_interval;
+    if (timerfd_settime(source->fd, 0, &spec, NULL) != 0)
+    {
+        perror("event loop: timerfd set failed.\n");
+        (void)close(source->fd);
+        
+        return 1;
+    }
+    
+    /* watch the timer fd */
+    source->type = EVENT_LOOP_SOURCE_TIMER;
+    source->chip = NULL;
+    source->line = NULL;
+    source->callback = callback;
+    source->user_data = user_data;
+    if (a_event_loop_watch(loop, source) != 0)
+    {
+        (void)close(source->fd);
+        
+        return 1;
+    }
+    loop->source_num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     event loop start
+ * @param[in] *loop pointer to an event loop structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      all the callbacks run on one loop pthread
+ */
+uint8_t event_loop_start(event_loop_t *loop)
+{
+    if ((loop == NULL) || (loop->running != 0))
+    {
+        return 1;
+    }
+    
+    /* creat the loop pthread */
+    if (pthread_create(&loop->pid, NULL, a_event_loop_pthread, loop) != 0)
+    {
+        perror("event loop: creat pthread failed.\n");
+        
+        return 1;
+    }
+    loop->running = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief     event loop stop
+ * @param[in] *loop pointer to an event loop structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      it wakes the loop through the eventfd and waits until no callback is running
+ */
+uint8_t event_loop_stop(event_loop_t *loop)
+{
+    uint64_t value = 1;
+    
+    if ((loop == NULL) || (loop->running == 0))
+    {
+        return 1;
+    }
+    
+    /* wake the loop */
+    if (write(loop->event_fd, &value, sizeof(uint64_t)) != (ssize_t)sizeof(uint64_t))
+    {
+        perror("event loop: eventfd write failed.\n");
+        
+        return 1;
+    }
+    (void)pthread_join(loop->pid, NULL);
+    loop->running = 0;
+    
+    /* consume the wake up, so the loop can be started again */
+    (void)read(loop->event_fd, &value, sizeof(uint64_t));
+    
+    return 0;
+}
+
+/**
+ * @brief     event loop deinit
+ * @param[in] *loop pointer to an event loop structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      it stops the loop if running and releases all the sources
+ */
+uint8_t event_loop_deinit(event_loop_t *loop)
+{
+    uint8_t i;
+    
+    if (loop == NULL)
+    {
+        return 1;
+    }
+    if (loop->running != 0)
+    {
+        if (event_loop_stop(loop) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    /* release the sources */
+    for (i = 0; i < loop->source_num; i++)
+    {
+        if (loop->source[i].type == EVENT_LOOP_SOURCE_GPIO)
+        {
+            gpiod_line_release(loop->source[i].line);
+            gpiod_chip_close(loop->source[i].chip);
+        }
+        else
+        {
+            (void)close(loop->source[i].fd);
+        }
+    }
+    loop->source_num = 0;
+    (void)close(loop->event_fd);
+    (void)close(loop->epoll_fd);
+    
+    return 0;
+}
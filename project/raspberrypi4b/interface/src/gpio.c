@@ -35,8 +35,10 @@
  */
 
 #include "gpio.h"
-#include <gpiod.h>
+#include "event_loop.h"
 #include <pthread.h>
+#include <string.h>
+#include <time.h>
 
 /**
  * @brief gpio device name definition
@@ -48,103 +50,230 @@
  */
 #define GPIO_DEVICE_LINE 17                      /**< gpio device line */
 
+/**
+ * @brief gpio edge queue size definition
+ */
+#define GPIO_EDGE_QUEUE_SIZE 64                  /**< edge queue size */
+
+/**
+ * @brief gpio edge structure definition
+ */
+typedef struct gpio_edge_s
+{
+    struct timespec ts;        /**< first edge timestamp */
+    uint32_t count;            /**< edges read in one wakeup */
+} gpio_edge_t;
+
 /**
  * @brief global var definition
  */
-static struct gpiod_chip *gs_chip;              /**< gpio chip handle */
-static struct gpiod_line *gs_line;              /**< gpio line handle */
-static pthread_t gs_pid;                        /**< gpio pthread pid */
-extern volatile uint8_t (*g_gpio_irq)(void);    /**< gpio extern callback */
+static event_loop_t gs_loop;                                    /**< edge event loop */
+static pthread_t gs_worker_pid;                                 /**< gpio worker pthread pid */
+static pthread_mutex_t gs_mutex = PTHREAD_MUTEX_INITIALIZER;    /**< edge queue mutex */
+static pthread_cond_t gs_cond = PTHREAD_COND_INITIALIZER;       /**< edge queue condition */
+static gpio_edge_t gs_queue[GPIO_EDGE_QUEUE_SIZE];              /**< edge queue */
+static uint32_t gs_head;                                        /**< edge queue write counter */
+static uint32_t gs_tail;                                        /**< edge queue read counter */
+static uint8_t gs_running;                                      /**< worker running flag */
+static volatile uint32_t gs_edge_count;                         /**< edges of the running callback */
+static gpio_interrupt_statistics_t gs_statistics;               /**< edge statistics */
+extern volatile uint8_t (*g_gpio_irq)(void);                    /**< gpio extern callback */
+
+/**
+ * @brief     gpio push edges to the queue
+ * @param[in] *ts pointer to the first edge timestamp
+ * @param[in] count edge number
+ * @note      top half, it only records the edges and wakes the worker
+ */
+static void a_gpio_edge_push(const struct timespec *ts, uint32_t count)
+{
+    uint32_t depth;
+    
+    pthread_mutex_lock(&gs_mutex);
+    gs_statistics.edge += count;
+    depth = gs_head - gs_tail;
+    if (depth >= GPIO_EDGE_QUEUE_SIZE)
+    {
+        /* the worker is too slow, drop the edges */
+        gs_statistics.lost += count;
+    }
+    else
+    {
+        gs_queue[gs_head % GPIO_EDGE_QUEUE_SIZE].ts = *ts;
+        gs_queue[gs_head % GPIO_EDGE_QUEUE_SIZE].count = count;
+        gs_head++;
+        if (depth + 1 > gs_statistics.max_depth)
+        {
+            gs_statistics.max_depth = depth + 1;
+        }
+        pthread_cond_signal(&gs_cond);
+    }
+    pthread_mutex_unlock(&gs_mutex);
+}
 
 /**
- * @brief  gpio interrupt pthread
+ * @brief  gpio interrupt worker pthread
  * @param  *p pointer to an args buffer
  * @return NULL
- * @note   none
+ * @note   bottom half, it merges all the queued edges into one g_gpio_irq call,
+ *         the chip status is read once and reflects the latest edge anyway
  */
-static void *a_gpio_interrupt_pthread(void *p)
+static void *a_gpio_worker_pthread(void *p)
 {
-    int res;
-    struct gpiod_line_event event;
+    int64_t latency_us;
+    uint32_t count;
+    struct timespec ts;
+    struct timespec now;
+    
+    (void)p;
+    
+    pthread_mutex_lock(&gs_mutex);
     
-    /* enable catching cancel signal */
-    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
-
-    /* cancel the pthread at once */
-    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
-
     /* loop */
     while (1)
     {
-        /* wait for the event */
-        res = gpiod_line_event_wait(gs_line, NULL);
-        if (res == 1)
+        /* wait for an edge */
+        while ((gs_running != 0) && (gs_head == gs_tail))
+        {
+            pthread_cond_wait(&gs_cond, &gs_mutex);
+        }
+        if (gs_running == 0)
+        {
+            break;
+        }
+        
+        /* take all the queued edges, the oldest one sets the latency */
+        ts = gs_queue[gs_tail % GPIO_EDGE_QUEUE_SIZE].ts;
+        count = 0;
+        while (gs_tail != gs_head)
         {
-            /* read the event */
-            if (gpiod_line_event_read(gs_line, &event) != 0)
-            {
-                continue;
-            }
-
-            /* if the falling edge */
-            if (event.event_type == GPIOD_LINE_EVENT_FALLING_EDGE)
-            {
-                /* check the callback and try to run */
-                if (g_gpio_irq != NULL)
-                {
-                    /* run the callback */
-                    g_gpio_irq();
-                }
-            }
+            count += gs_queue[gs_tail % GPIO_EDGE_QUEUE_SIZE].count;
+            gs_tail++;
+        }
+        pthread_mutex_unlock(&gs_mutex);
+        
+        /* kernel edge timestamps are monotonic since linux 5.7 */
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        latency_us = (int64_t)(now.tv_sec - ts.tv_sec) * 1000000 + (now.tv_nsec - ts.tv_nsec) / 1000;
+        
+        /* check the callback and try to run */
+        gs_edge_count = count;
+        if (g_gpio_irq != NULL)
+        {
+            /* run the callback */
+            g_gpio_irq();
+        }
+        
+        pthread_mutex_lock(&gs_mutex);
+        gs_statistics.handled++;
+        gs_statistics.merged += count - 1;
+        if (count > gs_statistics.max_merged)
+        {
+            gs_statistics.max_merged = count;
+        }
+        if ((latency_us > 0) && ((uint64_t)latency_us > gs_statistics.max_latency_us))
+        {
+            gs_statistics.max_latency_us = (uint32_t)latency_us;
         }
     }
+    
+    pthread_mutex_unlock(&gs_mutex);
+    
+    return NULL;
 }
 
 /**
- * @brief  gpio interrupt init
+ * @brief     gpio edge callback
+ * @param[in] *ts pointer to an edge timestamp
+ * @param[in] count edge number
+ * @param[in] *user_data pointer to the user data
+ * @note      it runs on the event loop pthread
+ */
+static void a_gpio_edge_callback(const struct timespec *ts, uint32_t count, void *user_data)
+{
+    (void)user_data;
+    
+    /* queue the edges of this wakeup */
+    a_gpio_edge_push(ts, count);
+}
+
+/**
+ * @brief  gpio worker start
  * @return status code
  *         - 0 success
- *         - 1 init failed
+ *         - 1 start failed
  * @note   none
  */
-uint8_t gpio_interrupt_init(void)
+static uint8_t a_gpio_worker_start(void)
 {
-    uint8_t res;
+    /* reset the queue */
+    pthread_mutex_lock(&gs_mutex);
+    gs_head = 0;
+    gs_tail = 0;
+    gs_running = 1;
+    memset(&gs_statistics, 0, sizeof(gpio_interrupt_statistics_t));
+    pthread_mutex_unlock(&gs_mutex);
     
-    /* open the gpio group */
-    gs_chip = gpiod_chip_open(GPIO_DEVICE_NAME);
-    if (gs_chip == NULL)
+    /* creat a gpio worker pthread */
+    if (pthread_create(&gs_worker_pid, NULL, a_gpio_worker_pthread, NULL) != 0)
     {
-        perror("gpio: open failed.\n");
-
+        perror("gpio: creat pthread failed.\n");
+        gs_running = 0;
+        
         return 1;
     }
     
-    /* get the gpio line */
-    gs_line = gpiod_chip_get_line(gs_chip, GPIO_DEVICE_LINE);
-    if (gs_line == NULL) 
-    {
-        perror("gpio: get line failed.\n");
-        gpiod_chip_close(gs_chip);
+    return 0;
+}
+
+/**
+ * @brief  gpio worker stop
+ * @note   none
+ */
+static void a_gpio_worker_stop(void)
+{
+    /* wake the worker and wait until the callback is not running */
+    pthread_mutex_lock(&gs_mutex);
+    gs_running = 0;
+    pthread_cond_signal(&gs_cond);
+    pthread_mutex_unlock(&gs_mutex);
+    (void)pthread_join(gs_worker_pid, NULL);
+}
 
+/**
+ * @brief  gpio interrupt init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   the event loop only queues the kernel timestamp, g_gpio_irq runs on a worker pthread
+ */
+uint8_t gpio_interrupt_init(void)
+{
+    /* watch the falling edge */
+    if (event_loop_init(&gs_loop) != 0)
+    {
         return 1;
     }
-
-    /* catch the falling edge */
-    if (gpiod_line_request_falling_edge_events(gs_line, "gpiointerrupt") < 0)
+    if (event_loop_add_gpio(&gs_loop, GPIO_DEVICE_NAME, GPIO_DEVICE_LINE, a_gpio_edge_callback, NULL) != 0)
     {
-        perror("gpio: set edge events failed.\n");
-        gpiod_chip_close(gs_chip);
-
+        (void)event_loop_deinit(&gs_loop);
+        
+        return 1;
+    }
+    
+    /* start the worker */
+    if (a_gpio_worker_start() != 0)
+    {
+        (void)event_loop_deinit(&gs_loop);
+        
         return 1;
     }
 
-    /* creat a gpio interrupt pthread */
-    res = pthread_create(&gs_pid, NULL, a_gpio_interrupt_pthread, NULL);
-    if (res != 0)
+    /* start the edge capture */
+    if (event_loop_start(&gs_loop) != 0)
     {
-        perror("gpio: creat pthread failed.\n");
-        gpiod_chip_close(gs_chip);
+        a_gpio_worker_stop();
+        (void)event_loop_deinit(&gs_loop);
 
         return 1;
     }
@@ -161,19 +290,93 @@ uint8_t gpio_interrupt_init(void)
  */
 uint8_t gpio_interrupt_deinit(void)
 {
-    uint8_t res;
-    
-    /* close the gpio interrupt pthread */
-    res = pthread_cancel(gs_pid);
-    if (res != 0)
+    /* stop the edge capture */
+    if (event_loop_stop(&gs_loop) != 0)
     {
-        perror("gpio: delete pthread failed.\n");
+        return 1;
+    }
+    
+    /* drop the queued edges */
+    a_gpio_worker_stop();
 
+    /* release the gpio line or the timer */
+    (void)event_loop_deinit(&gs_loop);
+    
+    return 0;
+}
+
+/**
+ * @brief     gpio simulated interrupt init
+ * @param[in] period_ms interrupt period in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      it queues an edge periodically without a gpio line, g_gpio_irq runs on the same worker,
+ *            gpio_interrupt_deinit stops it
+ */
+uint8_t gpio_interrupt_simulate_init(uint32_t period_ms)
+{
+    /* a timer instead of the gpio line */
+    if (event_loop_init(&gs_loop) != 0)
+    {
+        return 1;
+    }
+    if (event_loop_add_timer(&gs_loop, period_ms, a_gpio_edge_callback, NULL) != 0)
+    {
+        (void)event_loop_deinit(&gs_loop);
+        
+        return 1;
+    }
+    
+    /* start the worker */
+    if (a_gpio_worker_start() != 0)
+    {
+        (void)event_loop_deinit(&gs_loop);
+        
         return 1;
     }
+    
+    /* start the simulated edges */
+    if (event_loop_start(&gs_loop) != 0)
+    {
+        a_gpio_worker_stop();
+        (void)event_loop_deinit(&gs_loop);
+        
+        return 1;
+    }
+    
+    return 0;
+}
 
-    /* close the gpio */
-    gpiod_chip_close(gs_chip);
+/**
+ * @brief  gpio interrupt get the edge count
+ * @return edges merged into the running g_gpio_irq call
+ * @note   only valid inside g_gpio_irq
+ */
+uint32_t gpio_interrupt_get_edge_count(void)
+{
+    return gs_edge_count;
+}
+
+/**
+ * @brief      gpio interrupt get the statistics
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t gpio_interrupt_get_statistics(gpio_interrupt_statistics_t *statistics)
+{
+    if (statistics == NULL)
+    {
+        return 1;
+    }
+    
+    pthread_mutex_lock(&gs_mutex);
+    *statistics = gs_statistics;
+    statistics->depth = gs_head - gs_tail;
+    pthread_mutex_unlock(&gs_mutex);
     
     return 0;
 }
@@ -177,6 +177,66 @@ uint8_t iic_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
     return 0;
 }
 
+/**
+ * @brief         iic bus batch read
+ * @param[in]     fd iic handle
+ * @param[in,out] *vector pointer to a read vector buffer
+ * @param[in]     num vector number
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          addr = device_address_7bits << 1,
+ *                every IIC_READ_BATCH_MAX reads are packed into one I2C_RDWR transfer
+ */
+uint8_t iic_read_batch(int fd, iic_read_vector_t *vector, uint16_t num)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[IIC_READ_BATCH_MAX * 2];
+    uint16_t i;
+    uint16_t n;
+    
+    while (num != 0)
+    {
+        /* set the chunk size */
+        n = (num > IIC_READ_BATCH_MAX) ? IIC_READ_BATCH_MAX : num;
+        
+        /* clear ioctl data */
+        memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+        
+        /* clear msgs data */
+        memset(msgs, 0, sizeof(struct i2c_msg) * n * 2);
+        
+        /* set the param */
+        for (i = 0; i < n; i++)
+        {
+            msgs[i * 2 + 0].addr = vector[i].addr >> 1;
+            msgs[i * 2 + 0].flags = 0;
+            msgs[i * 2 + 0].buf = &vector[i].reg;
+            msgs[i * 2 + 0].len = 1;
+            msgs[i * 2 + 1].addr = vector[i].addr >> 1;
+            msgs[i * 2 + 1].flags = I2C_M_RD;
+            msgs[i * 2 + 1].buf = vector[i].buf;
+            msgs[i * 2 + 1].len = vector[i].len;
+        }
+        i2c_rdwr_data.msgs = msgs;
+        i2c_rdwr_data.nmsgs = n * 2;
+        
+        /* transmit */
+        if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+        {
+            perror("iic: read batch failed.\n");
+            
+            return 1;
+        }
+        
+        /* next chunk */
+        vector += n;
+        num -= n;
+    }
+    
+    return 0;
+}
+
 /**
  * @brief      iic bus read with 16 bits register address
  * @param[in]  fd iic handle
@@ -37,21 +37,110 @@
 #include "driver_mma7660fc_register_test.h"
 #include "driver_mma7660fc_read_test.h"
 #include "driver_mma7660fc_motion_test.h"
+#include "driver_mma7660fc_batch_test.h"
+#include "driver_mma7660fc_detect_test.h"
+#include "driver_mma7660fc_tilt_test.h"
+#include "driver_mma7660fc_filter_test.h"
+#include "driver_mma7660fc_calibration_test.h"
+#include "driver_mma7660fc_sim_test.h"
+#include "driver_mma7660fc_ring_test.h"
+#include "driver_mma7660fc_coalesce_test.h"
+#include "driver_mma7660fc_event_test.h"
+#include "driver_mma7660fc_sim_interface.h"
 #include "driver_mma7660fc_basic.h"
 #include "driver_mma7660fc_motion.h"
+#include "driver_mma7660fc_update.h"
+#include "raspberrypi4b_driver_mma7660fc_interface.h"
+#include "raspberrypi4b_driver_mma7660fc_poller.h"
 #include "gpio.h"
+#include "event_loop.h"
 #include <getopt.h>
 #include <stdlib.h>
 
 uint8_t (*g_gpio_irq)(void) = NULL;        /**< irq function address */
 static volatile uint16_t gs_flag = 0;      /**< motion flag */
+static mma7660fc_sim_t gs_sim;             /**< bus simulator */
+
+/**
+ * @brief bus simulator motion trace definition
+ * @note  every orientation, a shake, a vibration long enough for the tap debounce count,
+ *        a still time to auto sleep and a tilt to wake up
+ */
+#define SIM_MOTION_TAP_SAMPLES 48        /**< vibration samples at 120 samples/s */
+static const mma7660fc_sim_trace_t gs_sim_motion_key[] =
+{
+    {0, {0, 0, 1000}}, {300000, {0, 0, -1000}}, {600000, {1000, 0, 0}}, {900000, {-1000, 0, 0}},
+    {1200000, {0, 1000, 0}}, {1500000, {0, -1000, 0}}, {1800000, {0, 0, 1000}}, 
+    {2100000, {2000, 2000, 2000}}, {2200000, {0, 0, 1000}},
+};
+static mma7660fc_sim_trace_t gs_sim_motion_trace[sizeof(gs_sim_motion_key) / sizeof(gs_sim_motion_key[0]) + 
+                                                 SIM_MOTION_TAP_SAMPLES + 1];
+
+/**
+ * @brief  build the bus simulator motion trace
+ * @return trace length
+ * @note   none
+ */
+static uint32_t a_sim_motion_trace(void)
+{
+    uint32_t i;
+    uint32_t num;
+    
+    num = sizeof(gs_sim_motion_key) / sizeof(gs_sim_motion_key[0]);
+    memcpy(gs_sim_motion_trace, gs_sim_motion_key, sizeof(gs_sim_motion_key));
+    for (i = 0; i < SIM_MOTION_TAP_SAMPLES; i++)
+    {
+        gs_sim_motion_trace[num].time_us = 2300000 + i * 8333;
+        gs_sim_motion_trace[num].mg[0] = 0;
+        gs_sim_motion_trace[num].mg[1] = 0;
+        gs_sim_motion_trace[num].mg[2] = ((i % 2) == 0) ? 1300 : 1000;
+        num++;
+    }
+    gs_sim_motion_trace[num].time_us = 4000000;
+    gs_sim_motion_trace[num].mg[0] = 0;
+    gs_sim_motion_trace[num].mg[1] = 0;
+    gs_sim_motion_trace[num].mg[2] = -1000;
+    num++;
+    
+    return num;
+}
+
+/**
+ * @brief      link the tests to the bus simulator
+ * @param[in]  *irq pointer to a pin handler
+ * @param[out] *link pointer to a mma7660fc handle structure
+ * @note       the simulated chip is powered up lying on its front
+ */
+static void a_sim_bus_init(uint8_t (*irq)(void), mma7660fc_handle_t *link)
+{
+    static const int16_t flat[3] = {0, 0, 1000};
+    
+    (void)mma7660fc_sim_init(&gs_sim);
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    mma7660fc_sim_interface_bind(&gs_sim, irq);
+    
+    /* link sim interface function */
+    DRIVER_MMA7660FC_LINK_INIT(link, mma7660fc_handle_t);
+    DRIVER_MMA7660FC_LINK_IIC_INIT(link, mma7660fc_sim_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(link, mma7660fc_sim_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(link, mma7660fc_sim_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(link, mma7660fc_sim_iic_write);
+    DRIVER_MMA7660FC_LINK_IIC_READ_VECTOR(link, mma7660fc_sim_interface_iic_read_vector);
+    DRIVER_MMA7660FC_LINK_IIC_READ_ASYNC(link, mma7660fc_sim_interface_iic_read_async);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(link, mma7660fc_sim_interface_delay_ms);
+    DRIVER_MMA7660FC_LINK_GET_TIME_MS(link, mma7660fc_sim_get_time_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(link, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(link, mma7660fc_interface_receive_callback);
+    DRIVER_MMA7660FC_LINK_USER_DATA(link, &gs_sim);
+}
 
 /**
  * @brief     receive callback
  * @param[in] type irq type
+ * @param[in] *user_data pointer to the user data
  * @note      none
  */
-static void a_receive_callback(uint8_t type)
+static void a_receive_callback(uint8_t type, void *user_data)
 {
     switch (type)
     {
@@ -140,6 +229,36 @@ static void a_receive_callback(uint8_t type)
     }
 }
 
+/**
+ * @brief     loop timer callback
+ * @param[in] *ts pointer to a timestamp
+ * @param[in] count timer expirations
+ * @param[in] *user_data pointer to a mma7660fc handle structure
+ * @note      none
+ */
+static void a_loop_timer_callback(const struct timespec *ts, uint32_t count, void *user_data)
+{
+    float g[3];
+    mma7660fc_handle_t *handle = (mma7660fc_handle_t *)user_data;
+    mma7660fc_interface_context_t *context = (mma7660fc_interface_context_t *)handle->user_data;
+    
+    (void)ts;
+    
+    /* read data */
+    if (mma7660fc_basic_read_with_handle(handle, g) != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: %s read failed.\n", context->name);
+        
+        return;
+    }
+    if (count > 1)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: %s missed %d periods.\n", context->name, count - 1);
+    }
+    mma7660fc_interface_debug_print("mma7660fc: %s x is %0.2fg, y is %0.2fg, z is %0.2fg.\n", 
+                                    context->name, g[0], g[1], g[2]);
+}
+
 /**
  * @brief     mma7660fc full function
  * @param[in] argc arg numbers
@@ -164,11 +283,17 @@ uint8_t mma7660fc(uint8_t argc, char **argv)
         {"test", required_argument, NULL, 't'},
         {"times", required_argument, NULL, 1},
         {"timeout", required_argument, NULL, 2},
+        {"bus", required_argument, NULL, 3},
+        {"sim", optional_argument, NULL, 4},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
     uint32_t timeout = 10000;
+    char *bus[4] = {"/dev/i2c-1"};
+    uint8_t bus_num = 0;
+    uint32_t sim = 0;
+    uint8_t sim_bus = 0;
     
     /* if no params */
     if (argc == 1)
@@ -257,6 +382,36 @@ uint8_t mma7660fc(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* bus */
+            case 3 :
+            {
+                /* add the bus */
+                if (bus_num >= 4)
+                {
+                    return 5;
+                }
+                bus[bus_num] = optarg;
+                bus_num++;
+                
+                break;
+            } 
+            
+            /* bus simulator or simulated interrupt period */
+            case 4 :
+            {
+                /* without a period the tests run on the bus simulator */
+                if (optarg == NULL)
+                {
+                    sim_bus = 1;
+                }
+                else
+                {
+                    sim = atol(optarg);
+                }
+                
+                break;
+            } 
+            
             /* the end */
             case -1 :
             {
@@ -274,8 +429,23 @@ uint8_t mma7660fc(uint8_t argc, char **argv)
     /* run the function */
     if (strcmp("t_reg", type) == 0)
     {
+        uint8_t res;
+        
         /* run reg test */
-        if (mma7660fc_register_test() != 0)
+        if (sim_bus != 0)
+        {
+            mma7660fc_handle_t link;
+            
+            /* bus simulator init */
+            a_sim_bus_init(NULL, &link);
+            res = mma7660fc_register_test_with_link(&link);
+            mma7660fc_sim_interface_bind(NULL, NULL);
+        }
+        else
+        {
+            res = mma7660fc_register_test();
+        }
+        if (res != 0)
         {
             return 1;
         }
@@ -284,8 +454,42 @@ uint8_t mma7660fc(uint8_t argc, char **argv)
     }
     else if (strcmp("t_read", type) == 0)
     {
+        uint8_t res;
+        
         /* run read test */
-        if (mma7660fc_read_test(times) != 0)
+        if (sim_bus != 0)
+        {
+            mma7660fc_handle_t link;
+            
+            /* bus simulator init */
+            a_sim_bus_init(NULL, &link);
+            res = mma7660fc_read_test_with_link(&link, times);
+            mma7660fc_sim_interface_bind(NULL, NULL);
+        }
+        else
+        {
+            res = mma7660fc_read_test(times);
+        }
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if ((strcmp("t_motion", type) == 0) && (sim_bus != 0))
+    {
+        uint8_t res;
+        mma7660fc_handle_t link;
+        
+        /* bus simulator init, the pin is served by the virtual clock */
+        a_sim_bus_init(mma7660fc_motion_test_irq_handler, &link);
+        (void)mma7660fc_sim_set_trace(&gs_sim, gs_sim_motion_trace, a_sim_motion_trace());
+        
+        /* run motion test */
+        res = mma7660fc_motion_test_with_link(&link, timeout);
+        mma7660fc_sim_interface_bind(NULL, NULL);
+        if (res != 0)
         {
             return 1;
         }
@@ -320,6 +524,96 @@ uint8_t mma7660fc(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_batch", type) == 0)
+    {
+        /* run batch test */
+        if (mma7660fc_batch_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_detect", type) == 0)
+    {
+        /* run detect test */
+        if (mma7660fc_detect_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_tilt", type) == 0)
+    {
+        /* run tilt test */
+        if (mma7660fc_tilt_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_filter", type) == 0)
+    {
+        /* run filter test */
+        if (mma7660fc_filter_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_calibration", type) == 0)
+    {
+        /* run calibration test */
+        if (mma7660fc_calibration_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_sim", type) == 0)
+    {
+        /* run sim test */
+        if (mma7660fc_sim_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_ring", type) == 0)
+    {
+        /* run ring test */
+        if (mma7660fc_ring_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_coalesce", type) == 0)
+    {
+        /* run coalesce test */
+        if (mma7660fc_coalesce_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_event", type) == 0)
+    {
+        /* run event test */
+        if (mma7660fc_event_test() != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
@@ -417,6 +711,261 @@ uint8_t mma7660fc(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_poll", type) == 0)
+    {
+        uint8_t res;
+        uint8_t j;
+        uint32_t i;
+        static mma7660fc_handle_t handle[4];
+        static mma7660fc_interface_context_t context[4];
+        static mma7660fc_poller_sensor_t sensor[4];
+        static mma7660fc_poller_sample_t queue[4][16];
+        static mma7660fc_poller_t poller;
+        mma7660fc_poller_sample_t sample;
+        
+        /* default bus */
+        if (bus_num == 0)
+        {
+            bus_num = 1;
+        }
+        
+        /* poller init */
+        res = mma7660fc_poller_init(&poller);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* one sensor per bus */
+        for (j = 0; j < bus_num; j++)
+        {
+            context[j].name = bus[j];
+            context[j].fd = -1;
+            res = mma7660fc_basic_init_with_handle(&handle[j], &context[j]);
+            if (res != 0)
+            {
+                goto poll_deinit;
+            }
+            res = mma7660fc_poller_add_sensor(&poller, &sensor[j], &handle[j], bus[j], 
+                                              1000, queue[j], 16);
+            if (res != 0)
+            {
+                (void)mma7660fc_basic_deinit_with_handle(&handle[j]);
+                
+                goto poll_deinit;
+            }
+        }
+        
+        /* start polling */
+        res = mma7660fc_poller_start(&poller);
+        if (res != 0)
+        {
+            goto poll_deinit;
+        }
+        
+        /* loop */
+        for (i = 0; i < times; i++)
+        {
+            /* delay 1000ms */
+            mma7660fc_interface_delay_ms(1000);
+            
+            /* output */
+            for (j = 0; j < bus_num; j++)
+            {
+                while (mma7660fc_poller_pop(&sensor[j], &sample) == 0)
+                {
+                    mma7660fc_interface_debug_print("mma7660fc: %s x is %0.2fg, y is %0.2fg, z is %0.2fg.\n", 
+                                                    bus[j], sample.g[0], sample.g[1], sample.g[2]);
+                }
+            }
+        }
+        
+        /* stop polling */
+        (void)mma7660fc_poller_stop(&poller);
+        
+        poll_deinit:
+        for (i = 0; i < j; i++)
+        {
+            (void)mma7660fc_basic_deinit_with_handle(&handle[i]);
+        }
+        (void)mma7660fc_poller_deinit(&poller);
+        
+        return res == 0 ? 0 : 1;
+    }
+    else if (strcmp("e_loop", type) == 0)
+    {
+        uint8_t res;
+        uint8_t j;
+        uint8_t i;
+        static mma7660fc_handle_t handle[4];
+        static mma7660fc_interface_context_t context[4];
+        static event_loop_t loop;
+        
+        /* default bus */
+        if (bus_num == 0)
+        {
+            bus_num = 1;
+        }
+        
+        /* loop init */
+        res = event_loop_init(&loop);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* one timer per sensor, all on the loop pthread */
+        for (j = 0; j < bus_num; j++)
+        {
+            context[j].name = bus[j];
+            context[j].fd = -1;
+            res = mma7660fc_basic_init_with_handle(&handle[j], &context[j]);
+            if (res != 0)
+            {
+                goto loop_deinit;
+            }
+            res = event_loop_add_timer(&loop, 1000, a_loop_timer_callback, &handle[j]);
+            if (res != 0)
+            {
+                (void)mma7660fc_basic_deinit_with_handle(&handle[j]);
+                
+                goto loop_deinit;
+            }
+        }
+        
+        /* start the loop */
+        res = event_loop_start(&loop);
+        if (res != 0)
+        {
+            goto loop_deinit;
+        }
+        
+        /* delay times seconds */
+        mma7660fc_interface_delay_ms(times * 1000 + 500);
+        
+        /* stop the loop */
+        (void)event_loop_stop(&loop);
+        
+        loop_deinit:
+        (void)event_loop_deinit(&loop);
+        for (i = 0; i < j; i++)
+        {
+            (void)mma7660fc_basic_deinit_with_handle(&handle[i]);
+        }
+        
+        return res == 0 ? 0 : 1;
+    }
+    else if (strcmp("e_update", type) == 0)
+    {
+        uint8_t res;
+        uint32_t i;
+        uint32_t j;
+        uint8_t first;
+        uint32_t num;
+        uint32_t last;
+        uint32_t slot;
+        uint32_t period_us;
+        uint32_t missing;
+        uint32_t duplicate;
+        uint32_t overflow;
+        uint32_t read_error;
+        gpio_interrupt_statistics_t statistics;
+        static mma7660fc_ring_sample_t sample[MMA7660FC_UPDATE_DEFAULT_RING_SIZE];
+        
+        /* interrupt init */
+        g_gpio_irq = mma7660fc_update_irq_handler;
+        if (sim != 0)
+        {
+            res = gpio_interrupt_simulate_init(sim);
+        }
+        else
+        {
+            res = gpio_interrupt_init();
+        }
+        if (res != 0)
+        {
+            g_gpio_irq = NULL;
+            
+            return 1;
+        }
+        
+        /* update init after the interrupt, so the first update edge is not missed */
+        res = mma7660fc_update_init();
+        if (res != 0)
+        {
+            gpio_interrupt_deinit();
+            g_gpio_irq = NULL;
+            
+            return 1;
+        }
+        
+        /* the expected sample period */
+        if (sim != 0)
+        {
+            period_us = sim * 1000;
+        }
+        else
+        {
+            period_us = MMA7660FC_UPDATE_DEFAULT_SAMPLE_PERIOD_US;
+        }
+        
+        /* loop */
+        first = 1;
+        last = 0;
+        missing = 0;
+        duplicate = 0;
+        for (i = 0; i < times; i++)
+        {
+            /* delay 1000ms */
+            mma7660fc_interface_delay_ms(1000);
+            
+            /* read all the samples of the last second */
+            num = mma7660fc_update_read(sample, MMA7660FC_UPDATE_DEFAULT_RING_SIZE);
+            for (j = 0; j < num; j++)
+            {
+                /* round the gap to whole sample periods */
+                if (first == 0)
+                {
+                    slot = ((sample[j].timestamp - last) * 1000 + period_us / 2) / period_us;
+                    if (slot == 0)
+                    {
+                        duplicate++;
+                    }
+                    else
+                    {
+                        missing += slot - 1;
+                    }
+                }
+                last = sample[j].timestamp;
+                first = 0;
+            }
+            mma7660fc_update_get_counter(&overflow, &read_error);
+            
+            /* output */
+            mma7660fc_interface_debug_print("mma7660fc: %d/%d.\n", (uint32_t)(i + 1), (uint32_t)times);
+            mma7660fc_interface_debug_print("mma7660fc: %d samples, %d missing, %d duplicate, %d overflow, %d read error.\n", 
+                                            num, missing, duplicate, overflow, read_error);
+            if (num != 0)
+            {
+                mma7660fc_interface_debug_print("mma7660fc: x is %0.2fg.\n", (float)sample[num - 1].raw[0] / 21.33f);
+                mma7660fc_interface_debug_print("mma7660fc: y is %0.2fg.\n", (float)sample[num - 1].raw[1] / 21.33f);
+                mma7660fc_interface_debug_print("mma7660fc: z is %0.2fg.\n", (float)sample[num - 1].raw[2] / 21.33f);
+            }
+        }
+        
+        /* output the edge statistics */
+        (void)gpio_interrupt_get_statistics(&statistics);
+        mma7660fc_interface_debug_print("mma7660fc: %d edges, %d handled, %d merged, %d lost, max depth %d, max latency %dus.\n", 
+                                        statistics.edge, statistics.handled, statistics.merged, statistics.lost, 
+                                        statistics.max_depth, statistics.max_latency_us);
+        
+        /* deinit */
+        gpio_interrupt_deinit();
+        g_gpio_irq = NULL;
+        (void)mma7660fc_update_deinit();
+        
+        return 0;
+    }
     else if (strcmp("h", type) == 0)
     {
         help:
@@ -424,20 +973,35 @@ uint8_t mma7660fc(uint8_t argc, char **argv)
         mma7660fc_interface_debug_print("  mma7660fc (-i | --information)\n");
         mma7660fc_interface_debug_print("  mma7660fc (-h | --help)\n");
         mma7660fc_interface_debug_print("  mma7660fc (-p | --port)\n");
-        mma7660fc_interface_debug_print("  mma7660fc (-t reg | --test=reg)\n");
-        mma7660fc_interface_debug_print("  mma7660fc (-t read | --test=read) [--times=<num>]\n");
-        mma7660fc_interface_debug_print("  mma7660fc (-t motion | --test=motion) [--timeout=<ms>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t reg | --test=reg) [--sim]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t read | --test=read) [--sim] [--times=<num>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t motion | --test=motion) [--sim] [--timeout=<ms>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t batch | --test=batch) [--times=<num>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t detect | --test=detect) [--times=<num>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t tilt | --test=tilt) [--times=<num>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t filter | --test=filter) [--times=<num>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t calibration | --test=calibration)\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t sim | --test=sim)\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t ring | --test=ring)\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t coalesce | --test=coalesce)\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-t event | --test=event)\n");
         mma7660fc_interface_debug_print("  mma7660fc (-e read | --example=read) [--times=<num>]\n");
         mma7660fc_interface_debug_print("  mma7660fc (-e motion | --example=motion) [--timeout=<ms>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-e poll | --example=poll) [--bus=<path>] [--times=<num>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-e loop | --example=loop) [--bus=<path>] [--times=<num>]\n");
+        mma7660fc_interface_debug_print("  mma7660fc (-e update | --example=update) [--sim=<ms>] [--times=<num>]\n");
         mma7660fc_interface_debug_print("\n");
         mma7660fc_interface_debug_print("Options:\n");
-        mma7660fc_interface_debug_print("  -e <read | motion>, --example=<read | motion>\n");
+        mma7660fc_interface_debug_print("  -e <read | motion | poll | loop | update>, --example=<read | motion | poll | loop | update>\n");
         mma7660fc_interface_debug_print("                                     Run the driver example.\n");
         mma7660fc_interface_debug_print("  -h, --help                         Show the help.\n");
         mma7660fc_interface_debug_print("  -i, --information                  Show the chip information.\n");
         mma7660fc_interface_debug_print("  -p, --port                         Display the pin connections of the current board.\n");
-        mma7660fc_interface_debug_print("  -t <reg | read | motion>, --test=<reg | read | motion>\n");
+        mma7660fc_interface_debug_print("  -t <reg | read | motion | batch | detect | tilt | filter | calibration | sim | ring | coalesce | event>, --test=<reg | read | motion | batch | detect | tilt | filter | calibration | sim | ring | coalesce | event>\n");
         mma7660fc_interface_debug_print("                                     Run the driver test.\n");
+        mma7660fc_interface_debug_print("      --bus=<path>                   Add an iic bus to poll or loop, up to 4 buses.([default: /dev/i2c-1])\n");
+        mma7660fc_interface_debug_print("      --sim                          Run the reg, read or motion test on the bus simulator.\n");
+        mma7660fc_interface_debug_print("      --sim=<ms>                     Simulate the update interrupt with a period in ms instead of the INT pin.\n");
         mma7660fc_interface_debug_print("      --times=<num>                  Set the running times.([default: 3])\n");
         mma7660fc_interface_debug_print("      --timeout=<ms>                 Set timeout in ms.([default: 10000])\n");
         
@@ -141,6 +141,38 @@ uint8_t iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
  */
 uint8_t iic_read_address16(uint8_t addr, uint16_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      iic bus split-phase read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function address
+ * @param[in]  *context pointer to the completion context
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       addr = device_address_7bits << 1,
+ *             PB8 and PB9 are handed to I2C1 for the transfer and given back to the
+ *             software bus before done(context, status) runs in the interrupt
+ */
+uint8_t iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                       void (*done)(void *context, uint8_t status), void *context);
+
+/**
+ * @brief     iic bus split-phase read done
+ * @param[in] status transfer status
+ * @note      called from the i2c1 completion and error callbacks
+ */
+void iic_read_async_done(uint8_t status);
+
+/**
+ * @brief  iic get the handle
+ * @return pointer to an i2c handle
+ * @note   none
+ */
+I2C_HandleTypeDef* iic_get_handle(void);
+
 /**
  * @}
  */
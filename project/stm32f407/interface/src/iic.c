@@ -57,6 +57,14 @@
 #define IIC_SDA           PBout(9)
 #define READ_SDA          PBin(9)
 
+/**
+ * @brief iic split-phase read definition
+ */
+static I2C_HandleTypeDef gs_iic_handle;                            /**< i2c1 handle */
+static void (*gs_iic_done)(void *context, uint8_t status);         /**< completion function */
+static void *gs_iic_context;                                       /**< completion context */
+static volatile uint8_t gs_iic_busy;                               /**< transfer busy flag */
+
 /**
  * @brief  iic bus init
  * @return status code
@@ -611,3 +619,89 @@ uint8_t iic_read_address16(uint8_t addr, uint16_t reg, uint8_t *buf, uint16_t le
     
     return 0;
 }
+
+/**
+ * @brief      iic bus split-phase read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function address
+ * @param[in]  *context pointer to the completion context
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       addr = device_address_7bits << 1,
+ *             PB8 and PB9 are handed to I2C1 for the transfer and given back to the
+ *             software bus before done(context, status) runs in the interrupt
+ */
+uint8_t iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                       void (*done)(void *context, uint8_t status), void *context)
+{
+    /* check busy */
+    if (gs_iic_busy != 0)
+    {
+        return 1;
+    }
+    
+    /* i2c1 init */
+    gs_iic_handle.Instance = I2C1;
+    gs_iic_handle.Init.ClockSpeed = 100000;
+    gs_iic_handle.Init.DutyCycle = I2C_DUTYCYCLE_2;
+    gs_iic_handle.Init.OwnAddress1 = 0;
+    gs_iic_handle.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+    gs_iic_handle.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+    gs_iic_handle.Init.OwnAddress2 = 0;
+    gs_iic_handle.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+    gs_iic_handle.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+    if (HAL_I2C_Init(&gs_iic_handle) != HAL_OK)
+    {
+        (void)iic_init();
+        
+        return 1;
+    }
+    
+    /* start the interrupt read */
+    gs_iic_done = done;
+    gs_iic_context = context;
+    gs_iic_busy = 1;
+    if (HAL_I2C_Mem_Read_IT(&gs_iic_handle, addr, reg, I2C_MEMADD_SIZE_8BIT, buf, len) != HAL_OK)
+    {
+        gs_iic_busy = 0;
+        (void)HAL_I2C_DeInit(&gs_iic_handle);
+        (void)iic_init();
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     iic bus split-phase read done
+ * @param[in] status transfer status
+ * @note      called from the i2c1 completion and error callbacks
+ */
+void iic_read_async_done(uint8_t status)
+{
+    /* give the pins back to the software bus */
+    (void)HAL_I2C_DeInit(&gs_iic_handle);
+    (void)iic_init();
+    
+    /* complete the request */
+    gs_iic_busy = 0;
+    if (gs_iic_done != NULL)
+    {
+        gs_iic_done(gs_iic_context, status);
+    }
+}
+
+/**
+ * @brief  iic get the handle
+ * @return pointer to an i2c handle
+ * @note   none
+ */
+I2C_HandleTypeDef* iic_get_handle(void)
+{
+    return &gs_iic_handle;
+}
@@ -114,6 +114,18 @@ void USART1_IRQHandler(void);
  */
 void USART2_IRQHandler(void);
 
+/**
+ * @brief i2c1 event irq handler
+ * @note  none
+ */
+void I2C1_EV_IRQHandler(void);
+
+/**
+ * @brief i2c1 error irq handler
+ * @note  none
+ */
+void I2C1_ER_IRQHandler(void);
+
 /**
  * @}
  */
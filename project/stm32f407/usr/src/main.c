@@ -83,9 +83,10 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 /**
  * @brief     receive callback
  * @param[in] type irq type
+ * @param[in] *user_data pointer to the user data
  * @note      none
  */
-static void a_receive_callback(uint8_t type)
+static void a_receive_callback(uint8_t type, void *user_data)
 {
     switch (type)
     {
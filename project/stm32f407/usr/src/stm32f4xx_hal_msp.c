@@ -147,6 +147,60 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* huart)
     }
 }
 
+/**
+ * @brief     i2c hal init
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      none
+ */
+void HAL_I2C_MspInit(I2C_HandleTypeDef *hi2c)
+{
+    GPIO_InitTypeDef GPIO_InitStruct;
+    
+    if (hi2c->Instance == I2C1)
+    {
+        /* enable i2c gpio clock */
+        __HAL_RCC_GPIOB_CLK_ENABLE();
+        
+        /**
+         * PB8 ------> I2C1_SCL
+         * PB9 ------> I2C1_SDA 
+         */
+        GPIO_InitStruct.Pin = GPIO_PIN_8 | GPIO_PIN_9;
+        GPIO_InitStruct.Mode = GPIO_MODE_AF_OD;
+        GPIO_InitStruct.Pull = GPIO_PULLUP;
+        GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_HIGH;
+        GPIO_InitStruct.Alternate = GPIO_AF4_I2C1;
+        HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
+        
+        /* enable i2c1 clock */
+        __HAL_RCC_I2C1_CLK_ENABLE();
+        
+        /* enable nvic */
+        HAL_NVIC_SetPriority(I2C1_EV_IRQn, 2, 0);
+        HAL_NVIC_EnableIRQ(I2C1_EV_IRQn);
+        HAL_NVIC_SetPriority(I2C1_ER_IRQn, 2, 0);
+        HAL_NVIC_EnableIRQ(I2C1_ER_IRQn);
+    }
+}
+
+/**
+ * @brief     i2c hal deinit
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      the gpio is left to the software iic bus
+ */
+void HAL_I2C_MspDeInit(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* disable i2c1 clock */
+        __HAL_RCC_I2C1_CLK_DISABLE();
+        
+        /* disable nvic */
+        HAL_NVIC_DisableIRQ(I2C1_EV_IRQn);
+        HAL_NVIC_DisableIRQ(I2C1_ER_IRQn);
+    }
+}
+
 /**
  * @}
  */
@@ -36,6 +36,7 @@
 
 #include "stm32f4xx_it.h"
 #include "uart.h"
+#include "iic.h"
 
 /**
  * @brief nmi handler
@@ -164,6 +165,24 @@ void USART2_IRQHandler(void)
     HAL_UART_IRQHandler(uart2_get_handle());
 }
 
+/**
+ * @brief i2c1 event irq handler
+ * @note  none
+ */
+void I2C1_EV_IRQHandler(void)
+{
+    HAL_I2C_EV_IRQHandler(iic_get_handle());
+}
+
+/**
+ * @brief i2c1 error irq handler
+ * @note  none
+ */
+void I2C1_ER_IRQHandler(void)
+{
+    HAL_I2C_ER_IRQHandler(iic_get_handle());
+}
+
 /**
  * @brief     uart error callback
  * @param[in] *huart pointer to a uart handle
@@ -211,3 +230,31 @@ void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
         uart2_set_tx_done();
     }
 }
+
+/**
+ * @brief     i2c memory read finished callback
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      none
+ */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* complete the split-phase read */
+        iic_read_async_done(0);
+    }
+}
+
+/**
+ * @brief     i2c error callback
+ * @param[in] *hi2c pointer to an i2c handle
+ * @note      none
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c->Instance == I2C1)
+    {
+        /* fail the split-phase read */
+        iic_read_async_done(1);
+    }
+}
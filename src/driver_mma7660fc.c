@@ -68,6 +68,113 @@
 #define MMA7660FC_REG_PDET          0x09        /**< pdet register */
 #define MMA7660FC_REG_PD            0x0A        /**< pd register */
 
+/**
+ * @brief split-phase read state access definition
+ * @note  gcc and clang use acquire and release atomics so the completion publishes the buffer and status,
+ *        other compilers use volatile access which is enough for a single core mcu
+ */
+#if defined(__GNUC__)
+    #define MMA7660FC_ASYNC_LOAD(p)           __atomic_load_n((p), __ATOMIC_ACQUIRE)            /**< load acquire */
+    #define MMA7660FC_ASYNC_STORE(p, v)       __atomic_store_n((p), (v), __ATOMIC_RELEASE)      /**< store release */
+#else
+    #define MMA7660FC_ASYNC_LOAD(p)           (*(p))                                            /**< volatile load */
+    #define MMA7660FC_ASYNC_STORE(p, v)       (*(p) = (v))                                      /**< volatile store */
+#endif
+
+/**
+ * @brief calibration definition
+ * @note  mg = (count_q8 * 12002 + 32768) >> 16 equals count_q8 * 1000 / (21.33 * 256) rounded
+ */
+#define MMA7660FC_CALIBRATION_OFFSET_MAX        2048                  /**< max offset in 1/256 count */
+#define MMA7660FC_CALIBRATION_GAIN_MIN          8192                  /**< min gain, 0.5 */
+#define MMA7660FC_CALIBRATION_GAIN_MAX          32768                 /**< max gain, 2.0 */
+#define MMA7660FC_CALIBRATION_MG_MUL            12002                 /**< mg multiplier */
+#define MMA7660FC_CALIBRATION_G_PER_Q8          (1.0f / 5460.48f)     /**< g per 1/256 count */
+#define MMA7660FC_CALIBRATION_BIAS              0x40000000U           /**< floor shift bias */
+
+/**
+ * @brief tilt and srst event tables definition
+ * @note  bafro and pola are fields, so every code maps to at most one event,
+ *        the flag table is indexed by tilt bits 7:5 (shake, alert, tap)
+ */
+static const uint16_t gs_bafro_event_table[4] =
+{
+    0, MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_FRONT), MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_BACK), 0,
+};
+static const uint16_t gs_pola_event_table[8] =
+{
+    0, MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_LEFT), MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_RIGHT), 0,
+    0, MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_DOWN), MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_UP), 0,
+};
+static const uint16_t gs_flag_event_table[8] =
+{
+    0,
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_TAP),
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_UPDATE),
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_TAP) | MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_UPDATE),
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_SHAKE),
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_SHAKE) | MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_TAP),
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_SHAKE) | MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_UPDATE),
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_SHAKE) | MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_UPDATE) | 
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_TAP),
+};
+static const uint16_t gs_srst_event_table[4] =
+{
+    0,
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_AUTO_SLEEP),
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_AUTO_WAKE_UP),
+    MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_AUTO_SLEEP) | MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_AUTO_WAKE_UP),
+};
+
+/**
+ * @brief intsu source table definition
+ * @note  indexed by mma7660fc_status_t, the alert has no interrupt source
+ */
+static const uint8_t gs_intsu_source_table[MMA7660FC_EVENT_TYPE_NUM] =
+{
+    0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x00, 0xE0, 0x08, 0x08,
+};
+
+/**
+ * @brief g conversion table definition
+ * @note  indexed by the 6 bits register code, equals (float)raw / 21.33f
+ */
+static const float gs_g_table[64] =
+{
+    0.0f, 0.0468823239f, 0.0937646478f, 0.140646979f,
+    0.187529296f, 0.234411627f, 0.281293958f, 0.32817629f,
+    0.375058591f, 0.421940923f, 0.468823254f, 0.515705585f,
+    0.562587917f, 0.609470248f, 0.65635258f, 0.703234911f,
+    0.750117183f, 0.796999514f, 0.843881845f, 0.890764177f,
+    0.937646508f, 0.98452884f, 1.03141117f, 1.07829344f,
+    1.12517583f, 1.17205811f, 1.2189405f, 1.26582277f,
+    1.31270516f, 1.35958743f, 1.40646982f, 1.45335209f,
+    -1.50023437f, -1.45335209f, -1.40646982f, -1.35958743f,
+    -1.31270516f, -1.26582277f, -1.2189405f, -1.17205811f,
+    -1.12517583f, -1.07829344f, -1.03141117f, -0.98452884f,
+    -0.937646508f, -0.890764177f, -0.843881845f, -0.796999514f,
+    -0.750117183f, -0.703234911f, -0.65635258f, -0.609470248f,
+    -0.562587917f, -0.515705585f, -0.468823254f, -0.421940923f,
+    -0.375058591f, -0.32817629f, -0.281293958f, -0.234411627f,
+    -0.187529296f, -0.140646979f, -0.0937646478f, -0.0468823239f
+};
+
+/**
+ * @brief mg conversion table definition
+ * @note  indexed by the 6 bits register code, equals raw * 1000 / 21.33 rounded
+ */
+static const int16_t gs_mg_table[64] =
+{
+    0, 47, 94, 141, 188, 234, 281, 328,
+    375, 422, 469, 516, 563, 609, 656, 703,
+    750, 797, 844, 891, 938, 985, 1031, 1078,
+    1125, 1172, 1219, 1266, 1313, 1360, 1406, 1453,
+    -1500, -1453, -1406, -1360, -1313, -1266, -1219, -1172,
+    -1125, -1078, -1031, -985, -938, -891, -844, -797,
+    -750, -703, -656, -609, -563, -516, -469, -422,
+    -375, -328, -281, -234, -188, -141, -94, -47
+};
+
 /**
  * @brief      read bytes
  * @param[in]  *handle pointer to a mma7660fc handle structure
@@ -81,7 +188,7 @@
  */
 static uint8_t a_mma7660fc_iic_read(mma7660fc_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
-    if (handle->iic_read(MMA7660FC_ADDRESS, reg, buf, len) != 0)        /* read */
+    if (handle->iic_read(MMA7660FC_ADDRESS, reg, buf, len, handle->user_data) != 0)        /* read */
     {
         return 1;                                                       /* return error */
     }
@@ -102,7 +209,7 @@ static uint8_t a_mma7660fc_iic_read(mma7660fc_handle_t *handle, uint8_t reg, uin
  */
 static uint8_t a_mma7660fc_iic_write(mma7660fc_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
-    if (handle->iic_write(MMA7660FC_ADDRESS, reg, buf, len) != 0)        /* write */
+    if (handle->iic_write(MMA7660FC_ADDRESS, reg, buf, len, handle->user_data) != 0)        /* write */
     {
         return 1;                                                        /* return error */
     }
@@ -110,6 +217,332 @@ static uint8_t a_mma7660fc_iic_write(mma7660fc_handle_t *handle, uint8_t reg, ui
     return 0;                                                            /* success return 0 */
 }
 
+/**
+ * @brief      read several register blocks
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  *vector pointer to an iic vector buffer
+ * @param[in]  num vector number
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the blocks are read in one bus transaction when iic_read_vector is linked
+ */
+static uint8_t a_mma7660fc_iic_read_vector(mma7660fc_handle_t *handle, mma7660fc_iic_vector_t *vector, uint16_t num)
+{
+    uint16_t i;
+    
+    if (handle->iic_read_vector != NULL)                                                    /* vectored read */
+    {
+        if (handle->iic_read_vector(vector, num, handle->user_data) != 0)                   /* read */
+        {
+            return 1;                                                                       /* return error */
+        }
+        
+        return 0;                                                                           /* success return 0 */
+    }
+    for (i = 0; i < num; i++)                                                               /* read one by one */
+    {
+        if (handle->iic_read(vector[i].addr, vector[i].reg, 
+                             vector[i].buf, vector[i].len, handle->user_data) != 0)         /* read */
+        {
+            return 1;                                                                       /* return error */
+        }
+    }
+    
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief      read the config registers through the shadow
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       registers between spcnt and pd are served from the shadow when it is enabled
+ */
+static uint8_t a_mma7660fc_reg_read(mma7660fc_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if ((handle->shadow_enable == 0) ||                                                   /* check shadow enable */
+        (reg < MMA7660FC_REG_SPCNT) ||                                                    /* check the start */
+        ((uint16_t)(reg + len) > (uint16_t)(MMA7660FC_REG_PD + 1)))                       /* check the end */
+    {
+        return a_mma7660fc_iic_read(handle, reg, buf, len);                               /* read from the chip */
+    }
+    if (handle->shadow_valid == 0)                                                        /* if shadow is invalid */
+    {
+        if (a_mma7660fc_iic_read(handle, MMA7660FC_REG_SPCNT, handle->shadow, 6) != 0)    /* reload the shadow */
+        {
+            return 1;                                                                     /* return error */
+        }
+        handle->shadow_valid = 1;                                                         /* flag valid */
+    }
+    memcpy(buf, &handle->shadow[reg - MMA7660FC_REG_SPCNT], len);                         /* copy from the shadow */
+
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     write the config registers and update the shadow
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a failed write invalidates the shadow because the chip state is unknown,
+ *            the chip acknowledges but drops spcnt to pd writes out of standby, so the shadow
+ *            only takes them while the shadowed mode is standby
+ */
+static uint8_t a_mma7660fc_reg_write(mma7660fc_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint16_t addr;
+
+    if (a_mma7660fc_iic_write(handle, reg, buf, len) != 0)                                /* write */
+    {
+        handle->shadow_valid = 0;                                                         /* flag invalid */
+
+        return 1;                                                                         /* return error */
+    }
+    for (i = 0; i < len; i++)                                                             /* update overlapped bytes */
+    {
+        addr = (uint16_t)((reg + i) % (MMA7660FC_REG_PD + 1));                            /* auto increment wraps */
+        if (addr == MMA7660FC_REG_MODE)                                                   /* mode is always written */
+        {
+            handle->shadow[MMA7660FC_REG_MODE - MMA7660FC_REG_SPCNT] = buf[i];            /* update the shadow */
+        }
+        else if ((addr >= MMA7660FC_REG_SPCNT) &&                                         /* check the start */
+                 ((handle->shadow[MMA7660FC_REG_MODE - MMA7660FC_REG_SPCNT] & 0x01) == 0))/* and standby */
+        {
+            handle->shadow[addr - MMA7660FC_REG_SPCNT] = buf[i];                          /* update the shadow */
+        }
+        else
+        {
+            
+        }
+    }
+
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      encode the config to the register image
+ * @param[in]  *config pointer to a config structure
+ * @param[out] *buf pointer to a spcnt to pd buffer
+ * @note       none
+ */
+static void a_mma7660fc_config_encode(const mma7660fc_config_t *config, uint8_t buf[6])
+{
+    buf[0] = config->sleep_count;                                          /* set spcnt */
+    buf[1] = (uint8_t)((config->front_back_interrupt << 0) |               /* set front back interrupt */
+                       (config->up_down_right_left_interrupt << 1) |       /* set up down right left interrupt */
+                       (config->tap_interrupt << 2) |                      /* set tap interrupt */
+                       (config->auto_sleep_interrupt << 3) |               /* set auto sleep interrupt */
+                       (config->update_interrupt << 4) |                   /* set update interrupt */
+                       (config->shake_z_interrupt << 5) |                  /* set shake z interrupt */
+                       (config->shake_y_interrupt << 6) |                  /* set shake y interrupt */
+                       (config->shake_x_interrupt << 7));                  /* set shake x interrupt */
+    buf[2] = (uint8_t)((config->mode << 0) |                               /* set mode */
+                       (config->auto_wake_up << 3) |                       /* set auto wake up */
+                       (config->auto_sleep << 4) |                         /* set auto sleep */
+                       (config->sleep_counter_prescaler << 5) |            /* set sleep counter prescaler */
+                       (config->interrupt_pin_type << 6) |                 /* set interrupt pin type */
+                       (config->interrupt_active_level << 7));             /* set interrupt active level */
+    buf[3] = (uint8_t)((config->tap_detection_rate << 0) |                 /* set tap detection rate */
+                       (config->auto_wake_rate << 3) |                     /* set auto wake rate */
+                       (config->tilt_debounce_filter << 5));               /* set tilt debounce filter */
+    buf[4] = (uint8_t)((config->tap_detection_threshold << 0) |            /* set tap detection threshold */
+                       ((!config->tap_x_detection) << 5) |                 /* set tap x detection */
+                       ((!config->tap_y_detection) << 6) |                 /* set tap y detection */
+                       ((!config->tap_z_detection) << 7));                 /* set tap z detection */
+    buf[5] = config->tap_pulse_debounce_count;                             /* set pd */
+}
+
+/**
+ * @brief      decode the register image to the config
+ * @param[in]  *buf pointer to a spcnt to pd buffer
+ * @param[out] *config pointer to a config structure
+ * @note       none
+ */
+static void a_mma7660fc_config_decode(const uint8_t buf[6], mma7660fc_config_t *config)
+{
+    config->sleep_count = buf[0];                                                                         /* get spcnt */
+    config->front_back_interrupt = (mma7660fc_bool_t)((buf[1] >> 0) & 0x01);                              /* get front back interrupt */
+    config->up_down_right_left_interrupt = (mma7660fc_bool_t)((buf[1] >> 1) & 0x01);                      /* get up down right left interrupt */
+    config->tap_interrupt = (mma7660fc_bool_t)((buf[1] >> 2) & 0x01);                                     /* get tap interrupt */
+    config->auto_sleep_interrupt = (mma7660fc_bool_t)((buf[1] >> 3) & 0x01);                              /* get auto sleep interrupt */
+    config->update_interrupt = (mma7660fc_bool_t)((buf[1] >> 4) & 0x01);                                  /* get update interrupt */
+    config->shake_z_interrupt = (mma7660fc_bool_t)((buf[1] >> 5) & 0x01);                                 /* get shake z interrupt */
+    config->shake_y_interrupt = (mma7660fc_bool_t)((buf[1] >> 6) & 0x01);                                 /* get shake y interrupt */
+    config->shake_x_interrupt = (mma7660fc_bool_t)((buf[1] >> 7) & 0x01);                                 /* get shake x interrupt */
+    config->mode = (mma7660fc_mode_t)((buf[2] >> 0) & 0x07);                                              /* get mode */
+    config->auto_wake_up = (mma7660fc_bool_t)((buf[2] >> 3) & 0x01);                                      /* get auto wake up */
+    config->auto_sleep = (mma7660fc_bool_t)((buf[2] >> 4) & 0x01);                                        /* get auto sleep */
+    config->sleep_counter_prescaler = (mma7660fc_sleep_counter_prescaler_t)((buf[2] >> 5) & 0x01);       /* get sleep counter prescaler */
+    config->interrupt_pin_type = (mma7660fc_interrupt_pin_type_t)((buf[2] >> 6) & 0x01);                 /* get interrupt pin type */
+    config->interrupt_active_level = (mma7660fc_interrupt_active_level_t)((buf[2] >> 7) & 0x01);         /* get interrupt active level */
+    config->tap_detection_rate = (mma7660fc_auto_sleep_rate_t)((buf[3] >> 0) & 0x07);                    /* get tap detection rate */
+    config->auto_wake_rate = (mma7660fc_auto_wake_rate_t)((buf[3] >> 3) & 0x03);                         /* get auto wake rate */
+    config->tilt_debounce_filter = (mma7660fc_tilt_debounce_filter_t)((buf[3] >> 5) & 0x07);             /* get tilt debounce filter */
+    config->tap_detection_threshold = (uint8_t)((buf[4] >> 0) & 0x1F);                                   /* get tap detection threshold */
+    config->tap_x_detection = (mma7660fc_bool_t)(!((buf[4] >> 5) & 0x01));                                /* get tap x detection */
+    config->tap_y_detection = (mma7660fc_bool_t)(!((buf[4] >> 6) & 0x01));                                /* get tap y detection */
+    config->tap_z_detection = (mma7660fc_bool_t)(!((buf[4] >> 7) & 0x01));                                /* get tap z detection */
+    config->tap_pulse_debounce_count = buf[5];                                                            /* get pd */
+}
+
+/**
+ * @brief         read the registers with the alert bit again
+ * @param[in]     *handle pointer to a mma7660fc handle structure
+ * @param[in,out] *buf pointer to a data buffer started from xout
+ * @param[in]     len buffer length
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          each register is read at most handle->alert_retry times,
+ *                all flagged registers of one round are read in one vectored read
+ */
+static uint8_t a_mma7660fc_alert_retry(mma7660fc_handle_t *handle, uint8_t *buf, uint8_t len)
+{
+    uint8_t i;
+    uint8_t num;
+    uint8_t times;
+    mma7660fc_iic_vector_t vector[5];
+    
+    for (times = handle->alert_retry; times != 0; times--)                              /* retry rounds */
+    {
+        num = 0;                                                                        /* init 0 */
+        for (i = 0; (i < len) && (i < 5); i++)                                          /* check all registers */
+        {
+            if ((buf[i] & (1 << 6)) != 0)                                               /* if alert bit is set */
+            {
+                vector[num].addr = MMA7660FC_ADDRESS;                                   /* set the address */
+                vector[num].reg = (uint8_t)(MMA7660FC_REG_XOUT + i);                    /* set the register */
+                vector[num].buf = &buf[i];                                              /* set the buffer */
+                vector[num].len = 1;                                                    /* set the length */
+                num++;                                                                  /* num++ */
+            }
+        }
+        if (num == 0)                                                                   /* no alert */
+        {
+            break;                                                                      /* break */
+        }
+        if (a_mma7660fc_iic_read_vector(handle, vector, num) != 0)                      /* read the registers again */
+        {
+            return 1;                                                                   /* return error */
+        }
+        handle->alert_retry_count += num;                                               /* retry counter += num */
+    }
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     apply the calibration to one axis
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] axis axis index
+ * @param[in] raw raw code
+ * @return    calibrated count in 1/256 count
+ * @note      the biased unsigned shift is a floor shift without the implementation defined signed shift
+ */
+static int32_t a_mma7660fc_calibrate(mma7660fc_handle_t *handle, uint8_t axis, int8_t raw)
+{
+    int32_t v;
+    
+    v = ((int32_t)raw * 256 - handle->calibration.offset[axis]) * 
+        (int32_t)handle->calibration.gain[axis] + 8192;                                  /* remove offset and scale */
+    
+    return (int32_t)(((uint32_t)v + MMA7660FC_CALIBRATION_BIAS) >> 14) - 
+           (int32_t)(MMA7660FC_CALIBRATION_BIAS >> 14);                                  /* round to 1/256 count */
+}
+
+/**
+ * @brief      decode the xout to zout data
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  *buf pointer to a xout to zout buffer
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 data is invalid
+ * @note       none
+ */
+static uint8_t a_mma7660fc_decode(mma7660fc_handle_t *handle, uint8_t buf[3], int8_t raw[3], float g[3])
+{
+    uint8_t i;
+    uint8_t code;
+    
+    if (((buf[0] | buf[1] | buf[2]) & (1 << 6)) != 0)                      /* check alert bit */
+    {
+        handle->debug_print("mma7660fc: data is invalid.\n");              /* data is invalid */
+        
+        return 4;                                                          /* return error */
+    }
+    for (i = 0; i < 3; i++)
+    {
+        code = buf[i] & 0x3F;                                              /* get the 6 bits code */
+        raw[i] = (int8_t)((int8_t)(code ^ 0x20) - 0x20);                   /* sign extend */
+        if (handle->calibration_enable != 0)                               /* check calibration */
+        {
+            g[i] = (float)a_mma7660fc_calibrate(handle, i, raw[i]) * 
+                   MMA7660FC_CALIBRATION_G_PER_Q8;                         /* convert calibrated data */
+        }
+        else
+        {
+            g[i] = gs_g_table[code];                                       /* convert to real data */
+        }
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      decode the xout to zout data in mg
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  *buf pointer to a xout to zout buffer
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *mg pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 data is invalid
+ * @note       none
+ */
+static uint8_t a_mma7660fc_decode_mg(mma7660fc_handle_t *handle, uint8_t buf[3], int8_t raw[3], int16_t mg[3])
+{
+    uint8_t i;
+    uint8_t code;
+    int32_t v;
+    
+    if (((buf[0] | buf[1] | buf[2]) & (1 << 6)) != 0)                      /* check alert bit */
+    {
+        handle->debug_print("mma7660fc: data is invalid.\n");              /* data is invalid */
+        
+        return 4;                                                          /* return error */
+    }
+    for (i = 0; i < 3; i++)
+    {
+        code = buf[i] & 0x3F;                                              /* get the 6 bits code */
+        raw[i] = (int8_t)((int8_t)(code ^ 0x20) - 0x20);                   /* sign extend */
+        if (handle->calibration_enable != 0)                               /* check calibration */
+        {
+            v = a_mma7660fc_calibrate(handle, i, raw[i]) * 
+                MMA7660FC_CALIBRATION_MG_MUL + 32768;                      /* scale to mg */
+            mg[i] = (int16_t)((int32_t)(((uint32_t)v + MMA7660FC_CALIBRATION_BIAS) >> 16) - 
+                              (int32_t)(MMA7660FC_CALIBRATION_BIAS >> 16));                  /* round to mg */
+        }
+        else
+        {
+            mg[i] = gs_mg_table[code];                                     /* convert to real data */
+        }
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
 /**
  * @brief      get tilt status
  * @param[in]  *handle pointer to a mma7660fc handle structure
@@ -245,7 +678,7 @@ uint8_t mma7660fc_set_sleep_count(mma7660fc_handle_t *handle, uint8_t count)
     }
     
     prev = count;                                                              /* set sleep count */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_SPCNT, &prev, 1);        /* write spcnt */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_SPCNT, &prev, 1);        /* write spcnt */
     if (res != 0)                                                              /* check the result */
     {
         handle->debug_print("mma7660fc: write spcnt failed.\n");               /* write spcnt failed */
@@ -280,7 +713,7 @@ uint8_t mma7660fc_get_sleep_count(mma7660fc_handle_t *handle, uint8_t *count)
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SPCNT, count, 1);        /* read spcnt */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_SPCNT, count, 1);        /* read spcnt */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read spcnt failed.\n");               /* read spcnt failed */
@@ -316,7 +749,7 @@ uint8_t mma7660fc_set_front_back_interrupt(mma7660fc_handle_t *handle, mma7660fc
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -325,7 +758,7 @@ uint8_t mma7660fc_set_front_back_interrupt(mma7660fc_handle_t *handle, mma7660fc
     }
     prev &= ~(1 << 0);                                                        /* clear setting bit */
     prev |= (enable << 0);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write intsu failed.\n");              /* write intsu failed */
@@ -361,7 +794,7 @@ uint8_t mma7660fc_get_front_back_interrupt(mma7660fc_handle_t *handle, mma7660fc
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -398,7 +831,7 @@ uint8_t mma7660fc_set_up_down_right_left_interrupt(mma7660fc_handle_t *handle, m
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -407,7 +840,7 @@ uint8_t mma7660fc_set_up_down_right_left_interrupt(mma7660fc_handle_t *handle, m
     }
     prev &= ~(1 << 1);                                                        /* clear setting bit */
     prev |= (enable << 1);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write intsu failed.\n");              /* write intsu failed */
@@ -443,7 +876,7 @@ uint8_t mma7660fc_get_up_down_right_left_interrupt(mma7660fc_handle_t *handle, m
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -480,7 +913,7 @@ uint8_t mma7660fc_set_tap_interrupt(mma7660fc_handle_t *handle, mma7660fc_bool_t
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -489,7 +922,7 @@ uint8_t mma7660fc_set_tap_interrupt(mma7660fc_handle_t *handle, mma7660fc_bool_t
     }
     prev &= ~(1 << 2);                                                        /* clear setting bit */
     prev |= (enable << 2);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write intsu failed.\n");              /* write intsu failed */
@@ -525,7 +958,7 @@ uint8_t mma7660fc_get_tap_interrupt(mma7660fc_handle_t *handle, mma7660fc_bool_t
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -562,7 +995,7 @@ uint8_t mma7660fc_set_auto_sleep_interrupt(mma7660fc_handle_t *handle, mma7660fc
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -571,7 +1004,7 @@ uint8_t mma7660fc_set_auto_sleep_interrupt(mma7660fc_handle_t *handle, mma7660fc
     }
     prev &= ~(1 << 3);                                                        /* clear setting bit */
     prev |= (enable << 3);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write intsu failed.\n");              /* write intsu failed */
@@ -607,7 +1040,7 @@ uint8_t mma7660fc_get_auto_sleep_interrupt(mma7660fc_handle_t *handle, mma7660fc
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -644,7 +1077,7 @@ uint8_t mma7660fc_set_update_interrupt(mma7660fc_handle_t *handle, mma7660fc_boo
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -653,7 +1086,7 @@ uint8_t mma7660fc_set_update_interrupt(mma7660fc_handle_t *handle, mma7660fc_boo
     }
     prev &= ~(1 << 4);                                                        /* clear setting bit */
     prev |= (enable << 4);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write intsu failed.\n");              /* write intsu failed */
@@ -689,7 +1122,7 @@ uint8_t mma7660fc_get_update_interrupt(mma7660fc_handle_t *handle, mma7660fc_boo
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -726,7 +1159,7 @@ uint8_t mma7660fc_set_shake_x_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -735,7 +1168,7 @@ uint8_t mma7660fc_set_shake_x_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
     }
     prev &= ~(1 << 7);                                                        /* clear setting bit */
     prev |= (enable << 7);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write intsu failed.\n");              /* write intsu failed */
@@ -771,7 +1204,7 @@ uint8_t mma7660fc_get_shake_x_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -808,7 +1241,7 @@ uint8_t mma7660fc_set_shake_y_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -817,7 +1250,7 @@ uint8_t mma7660fc_set_shake_y_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
     }
     prev &= ~(1 << 6);                                                        /* clear setting bit */
     prev |= (enable << 6);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write intsu failed.\n");              /* write intsu failed */
@@ -853,7 +1286,7 @@ uint8_t mma7660fc_get_shake_y_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -890,7 +1323,7 @@ uint8_t mma7660fc_set_shake_z_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -899,7 +1332,7 @@ uint8_t mma7660fc_set_shake_z_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
     }
     prev &= ~(1 << 5);                                                        /* clear setting bit */
     prev |= (enable << 5);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &prev, 1);       /* write intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write intsu failed.\n");              /* write intsu failed */
@@ -935,7 +1368,7 @@ uint8_t mma7660fc_get_shake_z_interrupt(mma7660fc_handle_t *handle, mma7660fc_bo
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &prev, 1);        /* read intsu */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read intsu failed.\n");               /* read intsu failed */
@@ -972,7 +1405,7 @@ uint8_t mma7660fc_set_mode(mma7660fc_handle_t *handle, mma7660fc_mode_t mode)
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -981,7 +1414,7 @@ uint8_t mma7660fc_set_mode(mma7660fc_handle_t *handle, mma7660fc_mode_t mode)
     }
     prev &= ~(7 << 0);                                                        /* clear setting bit */
     prev |= (mode << 0);                                                      /* set mode */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write mode failed.\n");               /* write mode failed */
@@ -1017,7 +1450,7 @@ uint8_t mma7660fc_get_mode(mma7660fc_handle_t *handle, mma7660fc_mode_t *mode)
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1054,7 +1487,7 @@ uint8_t mma7660fc_set_auto_wake_up(mma7660fc_handle_t *handle, mma7660fc_bool_t
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1063,7 +1496,7 @@ uint8_t mma7660fc_set_auto_wake_up(mma7660fc_handle_t *handle, mma7660fc_bool_t
     }
     prev &= ~(1 << 3);                                                        /* clear setting bit */
     prev |= (enable << 3);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write mode failed.\n");               /* write mode failed */
@@ -1099,7 +1532,7 @@ uint8_t mma7660fc_get_auto_wake_up(mma7660fc_handle_t *handle, mma7660fc_bool_t
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1136,7 +1569,7 @@ uint8_t mma7660fc_set_auto_sleep(mma7660fc_handle_t *handle, mma7660fc_bool_t en
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1145,7 +1578,7 @@ uint8_t mma7660fc_set_auto_sleep(mma7660fc_handle_t *handle, mma7660fc_bool_t en
     }
     prev &= ~(1 << 4);                                                        /* clear setting bit */
     prev |= (enable << 4);                                                    /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write mode failed.\n");               /* write mode failed */
@@ -1181,7 +1614,7 @@ uint8_t mma7660fc_get_auto_sleep(mma7660fc_handle_t *handle, mma7660fc_bool_t *e
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1218,7 +1651,7 @@ uint8_t mma7660fc_set_sleep_counter_prescaler(mma7660fc_handle_t *handle, mma766
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1227,7 +1660,7 @@ uint8_t mma7660fc_set_sleep_counter_prescaler(mma7660fc_handle_t *handle, mma766
     }
     prev &= ~(1 << 5);                                                        /* clear setting bit */
     prev |= (prescaler << 5);                                                 /* set prescaler */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write mode failed.\n");               /* write mode failed */
@@ -1263,7 +1696,7 @@ uint8_t mma7660fc_get_sleep_counter_prescaler(mma7660fc_handle_t *handle, mma766
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1300,7 +1733,7 @@ uint8_t mma7660fc_set_interrupt_pin_type(mma7660fc_handle_t *handle, mma7660fc_i
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1309,7 +1742,7 @@ uint8_t mma7660fc_set_interrupt_pin_type(mma7660fc_handle_t *handle, mma7660fc_i
     }
     prev &= ~(1 << 6);                                                        /* clear setting bit */
     prev |= (type << 6);                                                      /* set type */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write mode failed.\n");               /* write mode failed */
@@ -1345,7 +1778,7 @@ uint8_t mma7660fc_get_interrupt_pin_type(mma7660fc_handle_t *handle, mma7660fc_i
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1382,7 +1815,7 @@ uint8_t mma7660fc_set_interrupt_active_level(mma7660fc_handle_t *handle, mma7660
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1391,7 +1824,7 @@ uint8_t mma7660fc_set_interrupt_active_level(mma7660fc_handle_t *handle, mma7660
     }
     prev &= ~(1 << 7);                                                        /* clear setting bit */
     prev |= (level << 7);                                                     /* set level */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: write mode failed.\n");               /* write mode failed */
@@ -1427,7 +1860,7 @@ uint8_t mma7660fc_get_interrupt_active_level(mma7660fc_handle_t *handle, mma7660
         return 3;                                                             /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
     if (res != 0)                                                             /* check the result */
     {
         handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
@@ -1464,7 +1897,7 @@ uint8_t mma7660fc_set_tap_detection_rate(mma7660fc_handle_t *handle, mma7660fc_a
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read sr failed.\n");                /* read sr failed */
@@ -1473,7 +1906,7 @@ uint8_t mma7660fc_set_tap_detection_rate(mma7660fc_handle_t *handle, mma7660fc_a
     }
     prev &= ~(7 << 0);                                                      /* clear setting bit */
     prev |= (rate << 0);                                                    /* set rate */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_SR, &prev, 1);        /* write sr */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_SR, &prev, 1);        /* write sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: write sr failed.\n");               /* write sr failed */
@@ -1509,7 +1942,7 @@ uint8_t mma7660fc_get_tap_detection_rate(mma7660fc_handle_t *handle, mma7660fc_a
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read sr failed.\n");                /* read sr failed */
@@ -1546,7 +1979,7 @@ uint8_t mma7660fc_set_auto_wake_rate(mma7660fc_handle_t *handle, mma7660fc_auto_
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read sr failed.\n");                /* read sr failed */
@@ -1555,7 +1988,7 @@ uint8_t mma7660fc_set_auto_wake_rate(mma7660fc_handle_t *handle, mma7660fc_auto_
     }
     prev &= ~(3 << 3);                                                      /* clear setting bit */
     prev |= (rate << 3);                                                    /* set rate */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_SR, &prev, 1);        /* write sr */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_SR, &prev, 1);        /* write sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: write sr failed.\n");               /* write sr failed */
@@ -1591,7 +2024,7 @@ uint8_t mma7660fc_get_auto_wake_rate(mma7660fc_handle_t *handle, mma7660fc_auto_
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read sr failed.\n");                /* read sr failed */
@@ -1628,7 +2061,7 @@ uint8_t mma7660fc_set_tilt_debounce_filter(mma7660fc_handle_t *handle, mma7660fc
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read sr failed.\n");                /* read sr failed */
@@ -1637,7 +2070,7 @@ uint8_t mma7660fc_set_tilt_debounce_filter(mma7660fc_handle_t *handle, mma7660fc
     }
     prev &= ~(7 << 5);                                                      /* clear setting bit */
     prev |= (filter << 5);                                                  /* set filter */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_SR, &prev, 1);        /* write sr */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_SR, &prev, 1);        /* write sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: write sr failed.\n");               /* write sr failed */
@@ -1673,7 +2106,7 @@ uint8_t mma7660fc_get_tilt_debounce_filter(mma7660fc_handle_t *handle, mma7660fc
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_SR, &prev, 1);         /* read sr */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read sr failed.\n");                /* read sr failed */
@@ -1717,7 +2150,7 @@ uint8_t mma7660fc_set_tap_detection_threshold(mma7660fc_handle_t *handle, uint8_
         return 4;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read pdet failed.\n");              /* read pdet failed */
@@ -1726,7 +2159,7 @@ uint8_t mma7660fc_set_tap_detection_threshold(mma7660fc_handle_t *handle, uint8_
     }
     prev &= ~(0x1F << 0);                                                   /* clear setting bit */
     prev |= (threshold << 0);                                               /* set threshold */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_PDET, &prev, 1);      /* write pdet */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_PDET, &prev, 1);      /* write pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: write pdet failed.\n");             /* write pdet failed */
@@ -1762,7 +2195,7 @@ uint8_t mma7660fc_get_tap_detection_threshold(mma7660fc_handle_t *handle, uint8_
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read pdet failed.\n");              /* read pdet failed */
@@ -1799,7 +2232,7 @@ uint8_t mma7660fc_set_tap_x_detection(mma7660fc_handle_t *handle, mma7660fc_bool
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read pdet failed.\n");              /* read pdet failed */
@@ -1808,7 +2241,7 @@ uint8_t mma7660fc_set_tap_x_detection(mma7660fc_handle_t *handle, mma7660fc_bool
     }
     prev &= ~(1 << 5);                                                      /* clear setting bit */
     prev |= ((!enable) << 5);                                               /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_PDET, &prev, 1);      /* write pdet */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_PDET, &prev, 1);      /* write pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: write pdet failed.\n");             /* write pdet failed */
@@ -1844,7 +2277,7 @@ uint8_t mma7660fc_get_tap_x_detection(mma7660fc_handle_t *handle, mma7660fc_bool
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read pdet failed.\n");              /* read pdet failed */
@@ -1881,7 +2314,7 @@ uint8_t mma7660fc_set_tap_y_detection(mma7660fc_handle_t *handle, mma7660fc_bool
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read pdet failed.\n");              /* read pdet failed */
@@ -1890,7 +2323,7 @@ uint8_t mma7660fc_set_tap_y_detection(mma7660fc_handle_t *handle, mma7660fc_bool
     }
     prev &= ~(1 << 6);                                                      /* clear setting bit */
     prev |= ((!enable) << 6);                                               /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_PDET, &prev, 1);      /* write pdet */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_PDET, &prev, 1);      /* write pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: write pdet failed.\n");             /* write pdet failed */
@@ -1926,7 +2359,7 @@ uint8_t mma7660fc_get_tap_y_detection(mma7660fc_handle_t *handle, mma7660fc_bool
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read pdet failed.\n");              /* read pdet failed */
@@ -1963,7 +2396,7 @@ uint8_t mma7660fc_set_tap_z_detection(mma7660fc_handle_t *handle, mma7660fc_bool
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read pdet failed.\n");              /* read pdet failed */
@@ -1972,7 +2405,7 @@ uint8_t mma7660fc_set_tap_z_detection(mma7660fc_handle_t *handle, mma7660fc_bool
     }
     prev &= ~(1 << 7);                                                      /* clear setting bit */
     prev |= ((!enable) << 7);                                               /* set bool */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_PDET, &prev, 1);      /* write pdet */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_PDET, &prev, 1);      /* write pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: write pdet failed.\n");             /* write pdet failed */
@@ -2008,7 +2441,7 @@ uint8_t mma7660fc_get_tap_z_detection(mma7660fc_handle_t *handle, mma7660fc_bool
         return 3;                                                           /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PDET, &prev, 1);       /* read pdet */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: read pdet failed.\n");              /* read pdet failed */
@@ -2046,7 +2479,7 @@ uint8_t mma7660fc_set_tap_pulse_debounce_count(mma7660fc_handle_t *handle, uint8
     }
     
     prev = count;                                                           /* set count */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_PD, &prev, 1);        /* write pd */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_PD, &prev, 1);        /* write pd */
     if (res != 0)                                                           /* check the result */
     {
         handle->debug_print("mma7660fc: write pd failed.\n");               /* write pd failed */
@@ -2081,7 +2514,7 @@ uint8_t mma7660fc_get_tap_pulse_debounce_count(mma7660fc_handle_t *handle, uint8
         return 3;                                                          /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_PD, count, 1);        /* read pd */
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_PD, count, 1);        /* read pd */
     if (res != 0)                                                          /* check the result */
     {
         handle->debug_print("mma7660fc: read pd failed.\n");               /* read pd failed */
@@ -2154,331 +2587,1556 @@ uint8_t mma7660fc_tap_pulse_debounce_convert_to_data(mma7660fc_handle_t *handle,
 }
 
 /**
- * @brief     irq handler
+ * @brief      decode the tilt and srst registers
+ * @param[in]  tilt tilt register
+ * @param[in]  srst srst register
+ * @param[out] *event pointer to an event structure
+ * @note       none
+ */
+static void a_mma7660fc_decode_event(uint8_t tilt, uint8_t srst, mma7660fc_event_t *event)
+{
+    uint8_t i;
+    
+    event->mask = gs_bafro_event_table[tilt & 0x03] |                            /* front back */
+                  gs_pola_event_table[(tilt >> 2) & 0x07] |                      /* portrait landscape */
+                  gs_flag_event_table[(tilt >> 5) & 0x07] |                      /* tap alert shake */
+                  gs_srst_event_table[srst & 0x03];                              /* auto sleep wake up */
+    event->bafro = (mma7660fc_bafro_t)((tilt >> 0) & 0x03);                      /* get back front */
+    event->pola = (mma7660fc_pola_t)((tilt >> 2) & 0x07);                        /* get portrait landscape */
+    event->tap = (mma7660fc_bool_t)((tilt >> 5) & 0x01);                         /* get tap */
+    event->alert = (mma7660fc_bool_t)((tilt >> 6) & 0x01);                       /* get alert */
+    event->shake = (mma7660fc_bool_t)((tilt >> 7) & 0x01);                       /* get shake */
+    event->auto_sleep = (mma7660fc_bool_t)((srst >> 0) & 0x01);                  /* get auto sleep */
+    event->auto_wake_up = (mma7660fc_bool_t)((srst >> 1) & 0x01);                /* get auto wake up */
+    for (i = 0; i < MMA7660FC_EVENT_TYPE_NUM; i++)                               /* one occurrence per set event */
+    {
+        event->count[i] = (uint16_t)((event->mask >> i) & 0x01);                 /* set the count */
+    }
+}
+
+/**
+ * @brief     write intsu in standby
  * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] intsu intsu register
  * @return    status code
  *            - 0 success
- *            - 1 run failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ *            - 1 write failed
+ * @note      the config registers are only writable in standby, the mode is restored after the write
  */
-uint8_t mma7660fc_irq_handler(mma7660fc_handle_t *handle)
+static uint8_t a_mma7660fc_write_intsu(mma7660fc_handle_t *handle, uint8_t intsu)
 {
-    uint8_t res;
-    uint8_t prev;
+    uint8_t mode;
+    uint8_t standby;
     
-    if (handle == NULL)                                                     /* check handle */
+    if (a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &mode, 1) != 0)                 /* read mode */
     {
-        return 2;                                                           /* return error */
+        return 1;                                                                        /* return error */
     }
-    if (handle->inited != 1)                                                /* check handle initialization */
+    standby = mode & (uint8_t)(~0x07);                                                   /* clear the mode bits */
+    if ((mode & 0x07) != 0)                                                              /* if not standby */
     {
-        return 3;                                                           /* return error */
+        if (a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &standby, 1) != 0)         /* enter standby */
+        {
+            return 1;                                                                    /* return error */
+        }
     }
-    
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_TILT, &prev, 1);       /* read tilt */
-    if (res != 0)                                                           /* check the result */
+    if (a_mma7660fc_reg_write(handle, MMA7660FC_REG_INTSU, &intsu, 1) != 0)              /* write intsu */
     {
-        handle->debug_print("mma7660fc: read tilt failed.\n");              /* read tilt failed */
-        
-        return 1;                                                           /* return error */
+        return 1;                                                                        /* return error */
     }
-    if ((prev & (1 << 0)) != 0)                                             /* if lying on its front */
+    if ((mode & 0x07) != 0)                                                              /* if not standby */
     {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        if (a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &mode, 1) != 0)            /* restore the mode */
         {
-            handle->receive_callback(MMA7660FC_STATUS_FRONT);               /* run callback */
+            return 1;                                                                    /* return error */
         }
     }
-    if ((prev & (1 << 1)) != 0)                                             /* if lying on its back */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief         coalesce the event
+ * @param[in]     *handle pointer to a mma7660fc handle structure
+ * @param[in,out] *event pointer to an event structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 intsu write failed
+ * @note          events inside their interval are removed from the mask and counted,
+ *                a pending count is delivered with the first event after the interval,
+ *                held off sources whose own end time passed are restored in the same intsu write
+ */
+static uint8_t a_mma7660fc_coalesce(mma7660fc_handle_t *handle, mma7660fc_event_t *event)
+{
+    uint8_t i;
+    uint8_t intsu;
+    uint8_t disable;
+    uint8_t restore;
+    uint16_t bit;
+    uint32_t now;
+    
+    if (handle->get_time_ms == NULL)                                                     /* no clock, no coalescing */
     {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
-        {
-            handle->receive_callback(MMA7660FC_STATUS_BACK);                /* run callback */
-        }
+        return 0;                                                                        /* success return 0 */
     }
-    if ((prev & (1 << 2)) != 0)                                             /* if landscape mode to the left */
+    now = handle->get_time_ms();                                                         /* get the time */
+    disable = 0;                                                                         /* init 0 */
+    for (i = 0; i < MMA7660FC_EVENT_TYPE_NUM; i++)                                       /* check all types */
     {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        if (handle->coalesce_interval[i] == 0)                                           /* no limit */
         {
-            handle->receive_callback(MMA7660FC_STATUS_LEFT);                /* run callback */
+            continue;                                                                    /* next */
         }
-    }
-    if ((prev & (2 << 2)) != 0)                                             /* if landscape mode to the right */
-    {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        bit = MMA7660FC_EVENT_MASK(i);                                                   /* get the bit */
+        if (((event->mask & bit) != 0) && (handle->coalesce_pending[i] != 0xFFFF))       /* if occurred */
         {
-            handle->receive_callback(MMA7660FC_STATUS_RIGHT);               /* run callback */
+            handle->coalesce_pending[i]++;                                               /* count it */
         }
-    }
-    if ((prev & (5 << 2)) != 0)                                             /* if standing vertically in inverted orientation */
-    {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        if (handle->coalesce_pending[i] == 0)                                            /* nothing pending */
         {
-            handle->receive_callback(MMA7660FC_STATUS_DOWN);                /* run callback */
+            continue;                                                                    /* next */
         }
-    }
-    if ((prev & (6 << 2)) != 0)                                             /* if standing vertically in normal orientation */
-    {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        if (((handle->coalesce_delivered & bit) == 0) ||                                 /* first event */
+            ((uint32_t)(now - handle->coalesce_last[i]) >= handle->coalesce_interval[i]))/* or interval passed */
         {
-            handle->receive_callback(MMA7660FC_STATUS_UP);                  /* run callback */
+            event->mask |= bit;                                                          /* deliver */
+            event->count[i] = handle->coalesce_pending[i];                               /* with the count */
+            handle->coalesce_pending[i] = 0;                                             /* clear pending */
+            handle->coalesce_last[i] = now;                                              /* save the time */
+            handle->coalesce_delivered |= bit;                                           /* flag delivered */
         }
-    }
-    if ((prev & (1 << 5)) != 0)                                             /* if detected a tap */
-    {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        else
         {
-            handle->receive_callback(MMA7660FC_STATUS_TAP);                 /* run callback */
+            if (((event->mask & bit) != 0) && (handle->coalesce_holdoff != 0))           /* if storm and holdoff */
+            {
+                disable |= gs_intsu_source_table[i];                                     /* disable the source */
+            }
+            event->mask &= (uint16_t)(~bit);                                             /* suppress */
+            event->count[i] = 0;                                                         /* clear the count */
         }
     }
-    if ((prev & (1 << 6)) != 0)                                             /* if data is invalid */
+    
+    restore = 0;                                                                         /* init 0 */
+    for (i = 0; i < 8; i++)                                                              /* check all sources */
     {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        if (((handle->coalesce_holdoff_intsu & (1 << i)) != 0) &&                        /* if held off */
+            ((int32_t)(now - handle->coalesce_holdoff_until[i]) >= 0))                   /* and its holdoff passed */
         {
-            handle->receive_callback(MMA7660FC_STATUS_UPDATE);              /* run callback */
+            restore |= (uint8_t)(1 << i);                                                /* restore it */
         }
     }
-    if ((prev & (1 << 7)) != 0)                                             /* if experiencing shake in one or more of the axes */
+    disable &= (uint8_t)(~handle->coalesce_holdoff_intsu);                               /* never extend a holdoff */
+    if ((restore == 0) && (disable == 0))                                                /* nothing to change */
     {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
-        {
-            handle->receive_callback(MMA7660FC_STATUS_SHAKE);               /* run callback */
-        }
+        return 0;                                                                        /* success return 0 */
     }
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SRST, &prev, 1);       /* read srst */
-    if (res != 0)                                                           /* check the result */
+    
+    if (a_mma7660fc_reg_read(handle, MMA7660FC_REG_INTSU, &intsu, 1) != 0)               /* read intsu */
     {
-        handle->debug_print("mma7660fc: read srst failed.\n");              /* read srst failed */
-        
-        return 1;                                                           /* return error */
+        return 1;                                                                        /* return error */
     }
-    if ((prev & (1 << 0)) != 0)                                             /* if auto sleep */
+    disable &= intsu;                                                                    /* only enabled sources */
+    if ((restore != 0) || (disable != 0))                                                /* if any */
     {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        if (a_mma7660fc_write_intsu(handle, (uint8_t)((intsu | restore) & 
+                                                      (uint8_t)(~disable))) != 0)        /* write intsu */
         {
-            handle->receive_callback(MMA7660FC_STATUS_AUTO_SLEEP);          /* run callback */
+            return 1;                                                                    /* return error */
         }
     }
-    if ((prev & (1 << 1)) != 0)                                             /* if wake up */
+    handle->coalesce_holdoff_intsu &= (uint8_t)(~restore);                               /* clear the restored sources */
+    handle->coalesce_holdoff_intsu |= disable;                                           /* save the new sources */
+    for (i = 0; i < 8; i++)                                                              /* set the end times */
     {
-        if (handle->receive_callback != NULL)                               /* if receive callback */
+        if ((disable & (1 << i)) != 0)                                                   /* if held off now */
         {
-            handle->receive_callback(MMA7660FC_STATUS_AUTO_WAKE_UP);        /* run callback */
+            handle->coalesce_holdoff_until[i] = now + handle->coalesce_holdoff;          /* set its end time */
         }
     }
     
-    return 0;                                                               /* success return 0 */
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     run the callbacks
  * @param[in] *handle pointer to a mma7660fc handle structure
- * @return    status code
- *            - 0 success
- *            - 1 iic initialization failed
- *            - 2 handle is NULL
- *            - 3 linked functions is NULL
+ * @param[in] *event pointer to an event structure
  * @note      none
  */
-uint8_t mma7660fc_init(mma7660fc_handle_t *handle)
+static void a_mma7660fc_run_callback(mma7660fc_handle_t *handle, const mma7660fc_event_t *event)
 {
-    if (handle == NULL)                                                       /* check handle */
-    {
-        return 2;                                                             /* return error */
-    }
-    if (handle->debug_print == NULL)                                          /* check debug_print */
-    {
-        return 3;                                                             /* return error */
-    }
-    if (handle->iic_init == NULL)                                             /* check iic_init */
+    uint8_t i;
+    uint16_t mask;
+    
+    if (event->mask == 0)                                                   /* all coalesced */
     {
-        handle->debug_print("mma7660fc: iic_init is null.\n");                /* iic_init is nul */
-        
-        return 3;                                                             /* return error */
+        return;                                                             /* nothing to do */
     }
-    if (handle->iic_deinit == NULL)                                           /* check iic_deinit */
+    if (handle->event_callback != NULL)                                     /* if event callback */
     {
-        handle->debug_print("mma7660fc: iic_deinit is null.\n");              /* iic_deinit is null */
-        
-        return 3;                                                             /* return error */
+        handle->event_callback(event, handle->user_data);                   /* run callback once */
     }
-    if (handle->iic_read == NULL)                                             /* check iic_read */
+    else if (handle->receive_callback != NULL)                              /* if receive callback */
     {
-        handle->debug_print("mma7660fc: iic_read is null.\n");                /* iic_read is null */
-        
-        return 3;                                                             /* return error */
+        mask = event->mask;                                                 /* get the mask */
+        for (i = 0; mask != 0; i++, mask >>= 1)                             /* in status order */
+        {
+            if ((mask & 0x01) != 0)                                         /* if the event is set */
+            {
+                handle->receive_callback(i, handle->user_data);             /* run callback */
+            }
+        }
     }
-    if (handle->iic_write == NULL)                                            /* check iic_write */
+}
+
+/**
+ * @brief     decode the tilt and srst registers and run the callbacks
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] tilt tilt register
+ * @param[in] srst srst register
+ * @return    status code
+ *            - 0 success
+ *            - 1 coalesce failed
+ * @note      none
+ */
+static uint8_t a_mma7660fc_dispatch_event(mma7660fc_handle_t *handle, uint8_t tilt, uint8_t srst)
+{
+    uint8_t res;
+    mma7660fc_event_t event;
+    
+    a_mma7660fc_decode_event(tilt, srst, &event);                           /* decode the event */
+    res = a_mma7660fc_coalesce(handle, &event);                             /* coalesce the event */
+    a_mma7660fc_run_callback(handle, &event);                               /* run the callbacks */
+    
+    return res;                                                             /* return the result */
+}
+
+/**
+ * @brief     irq handler
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      tilt and srst are read in one burst and decoded into one event, it is passed to
+ *            event_callback if linked, otherwise receive_callback runs once per set event
+ */
+uint8_t mma7660fc_irq_handler(mma7660fc_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_TILT, buf, 2);         /* read tilt and srst */
+    if (res != 0)                                                           /* check the result */
+    {
+        handle->debug_print("mma7660fc: read tilt failed.\n");              /* read tilt failed */
+        
+        return 1;                                                           /* return error */
+    }
+    res = a_mma7660fc_dispatch_event(handle, buf[0], buf[1]);               /* run the callbacks */
+    if (res != 0)                                                           /* check the result */
+    {
+        handle->debug_print("mma7660fc: write intsu failed.\n");            /* write intsu failed */
+        
+        return 1;                                                           /* return error */
+    }
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      irq handler with the data
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ * @note       for the update interrupt, xout to srst are read in one burst, so the sample and
+ *             the event come back together, the callbacks run before the data is decoded
+ */
+uint8_t mma7660fc_irq_handler_with_data(mma7660fc_handle_t *handle, int8_t raw[3], float g[3])
+{
+    uint8_t res;
+    uint8_t buf[5];
+    
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_XOUT, buf, 5);         /* read xout to srst */
+    if (res != 0)                                                           /* check the result */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");              /* read data failed */
+        
+        return 1;                                                           /* return error */
+    }
+    res = a_mma7660fc_alert_retry(handle, buf, 4);                          /* retry the alert registers */
+    if (res != 0)                                                           /* check the result */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");              /* read data failed */
+        
+        return 1;                                                           /* return error */
+    }
+    res = a_mma7660fc_dispatch_event(handle, buf[3], buf[4]);               /* run the callbacks */
+    if (res != 0)                                                           /* check the result */
+    {
+        handle->debug_print("mma7660fc: write intsu failed.\n");            /* write intsu failed */
+        
+        return 1;                                                           /* return error */
+    }
+    
+    return a_mma7660fc_decode(handle, buf, raw, g);                         /* decode the data */
+}
+
+/**
+ * @brief     set the event coalescing interval
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] type event type
+ * @param[in] interval_ms min interval between two deliveries, 0 means no limit
+ * @return    status code
+ *            - 0 success
+ *            - 1 get_time_ms is null
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 type is invalid
+ * @note      events inside the interval are counted and delivered later as one event with the count
+ */
+uint8_t mma7660fc_set_coalesce_interval(mma7660fc_handle_t *handle, mma7660fc_status_t type, uint16_t interval_ms)
+{
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if (handle->get_time_ms == NULL)                                        /* check get_time_ms */
+    {
+        handle->debug_print("mma7660fc: get_time_ms is null.\n");           /* get_time_ms is null */
+        
+        return 1;                                                           /* return error */
+    }
+    if ((uint8_t)type >= MMA7660FC_EVENT_TYPE_NUM)                          /* check the type */
+    {
+        handle->debug_print("mma7660fc: type is invalid.\n");               /* type is invalid */
+        
+        return 4;                                                           /* return error */
+    }
+    
+    handle->coalesce_interval[type] = interval_ms;                          /* set the interval */
+    handle->coalesce_pending[type] = 0;                                     /* clear pending */
+    handle->coalesce_delivered &= (uint16_t)(~MMA7660FC_EVENT_MASK(type));  /* restart */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the event coalescing interval
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  type event type
+ * @param[out] *interval_ms pointer to an interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 type is invalid
+ * @note       none
+ */
+uint8_t mma7660fc_get_coalesce_interval(mma7660fc_handle_t *handle, mma7660fc_status_t type, uint16_t *interval_ms)
+{
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if ((uint8_t)type >= MMA7660FC_EVENT_TYPE_NUM)                          /* check the type */
+    {
+        handle->debug_print("mma7660fc: type is invalid.\n");               /* type is invalid */
+        
+        return 4;                                                           /* return error */
+    }
+    
+    *interval_ms = handle->coalesce_interval[type];                         /* get the interval */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the interrupt source holdoff
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] holdoff_ms holdoff time, 0 means disable
+ * @return    status code
+ *            - 0 success
+ *            - 1 get_time_ms is null
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      a coalesced event disables its intsu source for the holdoff time,
+ *            every source has its own end time and a held off source is not extended,
+ *            the chip is put in standby for the intsu write
+ */
+uint8_t mma7660fc_set_coalesce_holdoff(mma7660fc_handle_t *handle, uint16_t holdoff_ms)
+{
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if (handle->get_time_ms == NULL)                                        /* check get_time_ms */
+    {
+        handle->debug_print("mma7660fc: get_time_ms is null.\n");           /* get_time_ms is null */
+        
+        return 1;                                                           /* return error */
+    }
+    
+    handle->coalesce_holdoff = holdoff_ms;                                  /* set the holdoff */
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     flush the coalesced events
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the irq handler does the same on every interrupt, call it when
+ *            mma7660fc_get_coalesce_deadline expires or periodically, so a held off source
+ *            comes back even when no other source interrupts
+ */
+uint8_t mma7660fc_coalesce_update(mma7660fc_handle_t *handle)
+{
+    uint8_t res;
+    mma7660fc_event_t event;
+    
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    
+    memset(&event, 0, sizeof(mma7660fc_event_t));                           /* no new event, unknown state */
+    res = a_mma7660fc_coalesce(handle, &event);                             /* flush the pending counts */
+    a_mma7660fc_run_callback(handle, &event);                               /* run the callbacks */
+    if (res != 0)                                                           /* check the result */
+    {
+        handle->debug_print("mma7660fc: write intsu failed.\n");            /* write intsu failed */
+        
+        return 1;                                                           /* return error */
+    }
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the time to the next coalescing deadline
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *ms pointer to a time buffer, 0xFFFFFFFF means no deadline
+ * @return     status code
+ *             - 0 success
+ *             - 1 get_time_ms is null
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the deadline is the nearest pending delivery or holdoff end,
+ *             a one shot timer can call mma7660fc_coalesce_update at it instead of polling
+ */
+uint8_t mma7660fc_get_coalesce_deadline(mma7660fc_handle_t *handle, uint32_t *ms)
+{
+    uint8_t i;
+    int32_t left;
+    uint32_t now;
+    
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if (handle->get_time_ms == NULL)                                        /* check get_time_ms */
+    {
+        handle->debug_print("mma7660fc: get_time_ms is null.\n");           /* get_time_ms is null */
+        
+        return 1;                                                           /* return error */
+    }
+    
+    now = handle->get_time_ms();                                            /* get the time */
+    *ms = 0xFFFFFFFFU;                                                      /* no deadline */
+    for (i = 0; i < MMA7660FC_EVENT_TYPE_NUM; i++)                          /* pending deliveries */
+    {
+        if ((handle->coalesce_interval[i] != 0) && (handle->coalesce_pending[i] != 0))
+        {
+            left = (int32_t)(handle->coalesce_last[i] + 
+                             handle->coalesce_interval[i] - now);           /* time left */
+            left = (left < 0) ? 0 : left;                                   /* already due */
+            *ms = ((uint32_t)left < *ms) ? (uint32_t)left : *ms;            /* keep the nearest */
+        }
+    }
+    for (i = 0; i < 8; i++)                                                 /* holdoff ends */
+    {
+        if ((handle->coalesce_holdoff_intsu & (1 << i)) != 0)
+        {
+            left = (int32_t)(handle->coalesce_holdoff_until[i] - now);      /* time left */
+            left = (left < 0) ? 0 : left;                                   /* already due */
+            *ms = ((uint32_t)left < *ms) ? (uint32_t)left : *ms;            /* keep the nearest */
+        }
+    }
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_init(mma7660fc_handle_t *handle)
+{
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->debug_print == NULL)                                          /* check debug_print */
+    {
+        return 3;                                                             /* return error */
+    }
+    if (handle->iic_init == NULL)                                             /* check iic_init */
+    {
+        handle->debug_print("mma7660fc: iic_init is null.\n");                /* iic_init is nul */
+        
+        return 3;                                                             /* return error */
+    }
+    if (handle->iic_deinit == NULL)                                           /* check iic_deinit */
+    {
+        handle->debug_print("mma7660fc: iic_deinit is null.\n");              /* iic_deinit is null */
+        
+        return 3;                                                             /* return error */
+    }
+    if (handle->iic_read == NULL)                                             /* check iic_read */
+    {
+        handle->debug_print("mma7660fc: iic_read is null.\n");                /* iic_read is null */
+        
+        return 3;                                                             /* return error */
+    }
+    if (handle->iic_write == NULL)                                            /* check iic_write */
+    {
+        handle->debug_print("mma7660fc: iic_write is null.\n");               /* iic_write is null */
+        
+        return 3;                                                             /* return error */
+    }
+    if ((handle->receive_callback == NULL) &&                                 /* check receive_callback */
+        (handle->event_callback == NULL))                                     /* and event_callback */
+    {
+        handle->debug_print("mma7660fc: receive_callback is null.\n");        /* receive_callback is null */
+        
+        return 3;                                                             /* return error */
+    }
+    if (handle->delay_ms == NULL)                                             /* check delay_ms */
+    {
+        handle->debug_print("mma7660fc: delay_ms is null.\n");                /* delay_ms is null */
+        
+        return 3;                                                             /* return error */
+    }
+    
+    if (handle->iic_init(handle->user_data) != 0)                             /* iic init */
+    {
+        handle->debug_print("mma7660fc: iic init failed.\n");                 /* iic init failed */
+        
+        return 1;                                                             /* return error */
+    }
+    handle->shadow_valid = 0;                                                 /* flag shadow invalid */
+    handle->async_state = 0;                                                  /* flag split-phase read idle */
+    handle->inited = 1;                                                       /* flag inited */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     close the chip
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 power down failed
+ * @note      none
+ */
+uint8_t mma7660fc_deinit(mma7660fc_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t prev;
+    
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
+    if (res != 0)                                                             /* check the result */
+    {
+        handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
+        
+        return 4;                                                             /* return error */
+    }
+    prev &= ~(7 << 0);                                                        /* clear setting bit */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
+    if (res != 0)                                                             /* check the result */
     {
-        handle->debug_print("mma7660fc: iic_write is null.\n");               /* iic_write is null */
+        handle->debug_print("mma7660fc: write mode failed.\n");               /* write mode failed */
+        
+        return 4;                                                             /* return error */
+    }
+    if (handle->iic_deinit(handle->user_data) != 0)                           /* iic deinit */
+    {
+        handle->debug_print("mma7660fc: iic deinit failed.\n");               /* iic deinit failed */
+        
+        return 1;                                                             /* return error */
+    }
+    handle->shadow_valid = 0;                                                 /* flag shadow invalid */
+    handle->inited = 0;                                                       /* flag close */
+    
+    return 0;                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      read the data
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw pressure buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ * @note       none
+ */
+uint8_t mma7660fc_read(mma7660fc_handle_t *handle, int8_t raw[3], float g[3])
+{
+    uint8_t res;
+    uint8_t buf[3];
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_XOUT, buf, 3);        /* read data */
+    if (res != 0)                                                          /* check the result */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");             /* read data failed */
+        
+        return 1;                                                          /* return error */
+    }
+    res = a_mma7660fc_alert_retry(handle, buf, 3);                         /* retry the alert registers */
+    if (res != 0)                                                          /* check the result */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");             /* read data failed */
+        
+        return 1;                                                          /* return error */
+    }
+    
+    return a_mma7660fc_decode(handle, buf, raw, g);                        /* decode the data */
+}
+
+/**
+ * @brief      read the data in mg
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *mg pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ * @note       integer only, no float operation is used
+ */
+uint8_t mma7660fc_read_mg(mma7660fc_handle_t *handle, int8_t raw[3], int16_t mg[3])
+{
+    uint8_t res;
+    uint8_t buf[3];
+    
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+    
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_XOUT, buf, 3);        /* read data */
+    if (res != 0)                                                          /* check the result */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");             /* read data failed */
+        
+        return 1;                                                          /* return error */
+    }
+    res = a_mma7660fc_alert_retry(handle, buf, 3);                         /* retry the alert registers */
+    if (res != 0)                                                          /* check the result */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");             /* read data failed */
+        
+        return 1;                                                          /* return error */
+    }
+    
+    return a_mma7660fc_decode_mg(handle, buf, raw, mg);                    /* decode the data */
+}
+
+/**
+ * @brief      read the data with the tilt and the sleep state
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @param[out] *state pointer to a state structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ * @note       xout to srst are read in one burst
+ */
+uint8_t mma7660fc_read_with_state(mma7660fc_handle_t *handle, int8_t raw[3], float g[3], mma7660fc_state_t *state)
+{
+    uint8_t res;
+    uint8_t buf[5];
+    
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_XOUT, buf, 5);              /* read xout to srst */
+    if (res != 0)                                                                /* check the result */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");                   /* read data failed */
+        
+        return 1;                                                                /* return error */
+    }
+    res = a_mma7660fc_alert_retry(handle, buf, 4);                               /* retry the alert registers */
+    if (res != 0)                                                                /* check the result */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");                   /* read data failed */
+        
+        return 1;                                                                /* return error */
+    }
+    if ((buf[3] & (1 << 6)) != 0)                                                /* check alert bit */
+    {
+        handle->debug_print("mma7660fc: tilt is invalid.\n");                    /* tilt is invalid */
+        
+        return 4;                                                                /* return error */
+    }
+    state->bafro = (mma7660fc_bafro_t)((buf[3] >> 0) & 0x03);                    /* get back front */
+    state->pola = (mma7660fc_pola_t)((buf[3] >> 2) & 0x07);                      /* get portrait landscape */
+    state->tap = (mma7660fc_bool_t)((buf[3] >> 5) & 0x01);                       /* get tap */
+    state->shake = (mma7660fc_bool_t)((buf[3] >> 7) & 0x01);                     /* get shake */
+    state->auto_sleep = (mma7660fc_bool_t)((buf[4] >> 0) & 0x01);                /* get auto sleep */
+    state->auto_wake_up = (mma7660fc_bool_t)((buf[4] >> 1) & 0x01);              /* get auto wake up */
+    
+    return a_mma7660fc_decode(handle, buf, raw, g);                              /* decode the data */
+}
+
+/**
+ * @brief     split-phase read completion
+ * @param[in] *context pointer to a mma7660fc handle structure
+ * @param[in] status bus status
+ * @note      called by the iic_read_async implementation when the transfer is finished
+ */
+static void a_mma7660fc_read_done(void *context, uint8_t status)
+{
+    mma7660fc_handle_t *handle = (mma7660fc_handle_t *)context;
+    
+    handle->async_status = status;                                          /* save the status */
+    MMA7660FC_ASYNC_STORE(&handle->async_state, 2);                         /* flag done, publish the buffer and status */
+    if (handle->read_done_callback != NULL)                                 /* if read done callback */
+    {
+        handle->read_done_callback(handle->user_data);                      /* run callback */
+    }
+}
+
+/**
+ * @brief     start a split-phase read of the data
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 read is busy
+ *            - 5 iic_read_async is null
+ * @note      the bus completion runs read_done_callback if it is linked
+ */
+uint8_t mma7660fc_read_start(mma7660fc_handle_t *handle)
+{
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if (MMA7660FC_ASYNC_LOAD(&handle->async_state) == 1)                    /* check busy */
+    {
+        handle->debug_print("mma7660fc: read is busy.\n");                  /* read is busy */
+        
+        return 4;                                                           /* return error */
+    }
+    if (handle->iic_read_async == NULL)                                     /* check iic_read_async */
+    {
+        handle->debug_print("mma7660fc: iic_read_async is null.\n");        /* iic_read_async is null */
+        
+        return 5;                                                           /* return error */
+    }
+    
+    MMA7660FC_ASYNC_STORE(&handle->async_state, 1);                         /* flag busy */
+    if (handle->iic_read_async(MMA7660FC_ADDRESS, MMA7660FC_REG_XOUT, 
+                               handle->async_buf, 3, a_mma7660fc_read_done, 
+                               handle, handle->user_data) != 0)             /* start the read */
+    {
+        MMA7660FC_ASYNC_STORE(&handle->async_state, 0);                     /* flag idle */
+        handle->debug_print("mma7660fc: read start failed.\n");             /* read start failed */
+        
+        return 1;                                                           /* return error */
+    }
+    
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      complete a split-phase read of the data
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ *             - 5 read is busy
+ *             - 6 read is not started
+ * @note       the data is decoded as mma7660fc_read does,
+ *             the alert bit is not retried and the read can be started again
+ */
+uint8_t mma7660fc_read_complete(mma7660fc_handle_t *handle, int8_t raw[3], float g[3])
+{
+    uint8_t state;
+    
+    if (handle == NULL)                                                     /* check handle */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (handle->inited != 1)                                                /* check handle initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    state = MMA7660FC_ASYNC_LOAD(&handle->async_state);                     /* acquire the state */
+    if (state == 0)                                                         /* check started */
+    {
+        return 6;                                                           /* return error */
+    }
+    if (state == 1)                                                         /* check busy */
+    {
+        return 5;                                                           /* return error */
+    }
+    
+    MMA7660FC_ASYNC_STORE(&handle->async_state, 0);                         /* flag idle */
+    if (handle->async_status != 0)                                          /* check the status */
+    {
+        handle->debug_print("mma7660fc: read data failed.\n");              /* read data failed */
+        
+        return 1;                                                           /* return error */
+    }
+    
+    return a_mma7660fc_decode(handle, handle->async_buf, raw, g);           /* decode the data */
+}
+
+/**
+ * @brief     enable or disable the shadow register
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set shadow failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      enabling the shadow loads spcnt to pd in one burst read
+ */
+uint8_t mma7660fc_set_shadow(mma7660fc_handle_t *handle, mma7660fc_bool_t enable)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    handle->shadow_valid = 0;                                             /* flag invalid */
+    handle->shadow_enable = (uint8_t)enable;                              /* set enable */
+    if (enable == MMA7660FC_BOOL_TRUE)                                    /* if enable */
+    {
+        if (mma7660fc_shadow_sync(handle) != 0)                           /* sync the shadow */
+        {
+            handle->shadow_enable = 0;                                    /* disable the shadow */
+            
+            return 1;                                                     /* return error */
+        }
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the shadow register status
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mma7660fc_get_shadow(mma7660fc_handle_t *handle, mma7660fc_bool_t *enable)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    
+    *enable = (mma7660fc_bool_t)(handle->shadow_enable);              /* get bool */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     reload the shadow register from the chip
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 shadow sync failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mma7660fc_shadow_sync(mma7660fc_handle_t *handle)
+{
+    uint8_t res;
+    
+    if (handle == NULL)                                                               /* check handle */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                          /* check handle initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    handle->shadow_valid = 0;                                                         /* flag invalid */
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SPCNT, handle->shadow, 6);       /* read spcnt to pd */
+    if (res != 0)                                                                     /* check the result */
+    {
+        handle->debug_print("mma7660fc: read spcnt to pd failed.\n");                /* read spcnt to pd failed */
         
-        return 3;                                                             /* return error */
+        return 1;                                                                     /* return error */
     }
-    if (handle->receive_callback == NULL)                                     /* check receive_callback */
+    handle->shadow_valid = 1;                                                         /* flag valid */
+    
+    return 0;                                                                         /* success return 0 */
+}
+
+/**
+ * @brief     invalidate the shadow register
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the next access reloads the shadow in one burst read
+ */
+uint8_t mma7660fc_shadow_invalidate(mma7660fc_handle_t *handle)
+{
+    if (handle == NULL)                              /* check handle */
     {
-        handle->debug_print("mma7660fc: receive_callback is null.\n");        /* receive_callback is null */
-        
-        return 3;                                                             /* return error */
+        return 2;                                    /* return error */
     }
-    if (handle->delay_ms == NULL)                                             /* check delay_ms */
+    if (handle->inited != 1)                         /* check handle initialization */
     {
-        handle->debug_print("mma7660fc: delay_ms is null.\n");                /* delay_ms is null */
-        
-        return 3;                                                             /* return error */
+        return 3;                                    /* return error */
     }
     
-    if (handle->iic_init() != 0)                                              /* iic init */
+    handle->shadow_valid = 0;                        /* flag invalid */
+    
+    return 0;                                        /* success return 0 */
+}
+
+/**
+ * @brief     set the alert retry times
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] times retry times of each register
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      when the alert bit is set, only the offending register is read again,
+ *            0 means no retry and the read returns the invalid error at once
+ */
+uint8_t mma7660fc_set_alert_retry(mma7660fc_handle_t *handle, uint8_t times)
+{
+    if (handle == NULL)                     /* check handle */
     {
-        handle->debug_print("mma7660fc: iic init failed.\n");                 /* iic init failed */
-        
-        return 1;                                                             /* return error */
+        return 2;                           /* return error */
+    }
+    if (handle->inited != 1)                /* check handle initialization */
+    {
+        return 3;                           /* return error */
     }
-    handle->inited = 1;                                                       /* flag inited */
     
-    return 0;                                                                 /* success return 0 */
+    handle->alert_retry = times;            /* set times */
+    
+    return 0;                               /* success return 0 */
 }
 
 /**
- * @brief     close the chip
+ * @brief      get the alert retry times
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *times pointer to a retry times buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mma7660fc_get_alert_retry(mma7660fc_handle_t *handle, uint8_t *times)
+{
+    if (handle == NULL)                     /* check handle */
+    {
+        return 2;                           /* return error */
+    }
+    if (handle->inited != 1)                /* check handle initialization */
+    {
+        return 3;                           /* return error */
+    }
+    
+    *times = handle->alert_retry;           /* get times */
+    
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the alert retry counter
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *count pointer to a counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the counter is the total number of the register read again
+ */
+uint8_t mma7660fc_get_alert_retry_counter(mma7660fc_handle_t *handle, uint32_t *count)
+{
+    if (handle == NULL)                           /* check handle */
+    {
+        return 2;                                 /* return error */
+    }
+    if (handle->inited != 1)                      /* check handle initialization */
+    {
+        return 3;                                 /* return error */
+    }
+    
+    *count = handle->alert_retry_count;           /* get counter */
+    
+    return 0;                                     /* success return 0 */
+}
+
+/**
+ * @brief     clear the alert retry counter
  * @param[in] *handle pointer to a mma7660fc handle structure
  * @return    status code
  *            - 0 success
- *            - 1 iic deinit failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- *            - 4 power down failed
  * @note      none
  */
-uint8_t mma7660fc_deinit(mma7660fc_handle_t *handle)
+uint8_t mma7660fc_clear_alert_retry_counter(mma7660fc_handle_t *handle)
+{
+    if (handle == NULL)                     /* check handle */
+    {
+        return 2;                           /* return error */
+    }
+    if (handle->inited != 1)                /* check handle initialization */
+    {
+        return 3;                           /* return error */
+    }
+    
+    handle->alert_retry_count = 0;          /* clear counter */
+    
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief     apply the whole config
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply config failed
+ *            - 2 handle or config is NULL
+ *            - 3 handle is not initialized
+ *            - 4 tap detection threshold > 31
+ * @note      the chip enters standby, spcnt to pd are written in one auto increment burst
+ *            and then the chip enters config->mode
+ */
+uint8_t mma7660fc_apply_config(mma7660fc_handle_t *handle, const mma7660fc_config_t *config)
 {
     uint8_t res;
-    uint8_t prev;
+    uint8_t buf[6];
+    uint8_t mode;
     
-    if (handle == NULL)                                                       /* check handle */
+    if ((handle == NULL) || (config == NULL))                                    /* check handle and config */
     {
-        return 2;                                                             /* return error */
+        return 2;                                                                /* return error */
     }
-    if (handle->inited != 1)                                                  /* check handle initialization */
+    if (handle->inited != 1)                                                     /* check handle initialization */
     {
-        return 3;                                                             /* return error */
+        return 3;                                                                /* return error */
+    }
+    if (config->tap_detection_threshold > 31)                                    /* check the threshold */
+    {
+        handle->debug_print("mma7660fc: threshold > 31.\n");                     /* threshold > 31 */
+        
+        return 4;                                                                /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_MODE, &prev, 1);         /* read mode */
-    if (res != 0)                                                             /* check the result */
+    a_mma7660fc_config_encode(config, buf);                                      /* encode the config */
+    mode = buf[2] & 0x07;                                                        /* save the target mode */
+    buf[2] &= ~(7 << 0);                                                         /* keep standby during the burst */
+    if ((handle->shadow_enable == 0) || (handle->shadow_valid == 0) ||           /* if the mode is unknown */
+        ((handle->shadow[2] & 0x07) != 0))                                       /* or the chip is not in standby */
     {
-        handle->debug_print("mma7660fc: read mode failed.\n");                /* read mode failed */
+        res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &buf[2], 1);     /* enter standby */
+        if (res != 0)                                                            /* check the result */
+        {
+            handle->debug_print("mma7660fc: write mode failed.\n");              /* write mode failed */
+            
+            return 1;                                                            /* return error */
+        }
+    }
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_SPCNT, buf, 6);            /* write spcnt to pd */
+    if (res != 0)                                                                /* check the result */
+    {
+        handle->debug_print("mma7660fc: write spcnt to pd failed.\n");           /* write spcnt to pd failed */
         
-        return 4;                                                             /* return error */
+        return 1;                                                                /* return error */
     }
-    prev &= ~(7 << 0);                                                        /* clear setting bit */
-    res = a_mma7660fc_iic_write(handle, MMA7660FC_REG_MODE, &prev, 1);        /* write mode */
-    if (res != 0)                                                             /* check the result */
+    if (mode != 0)                                                               /* if not standby */
     {
-        handle->debug_print("mma7660fc: write mode failed.\n");               /* write mode failed */
+        buf[2] |= mode;                                                          /* set the target mode */
+        res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &buf[2], 1);     /* write mode */
+        if (res != 0)                                                            /* check the result */
+        {
+            handle->debug_print("mma7660fc: write mode failed.\n");              /* write mode failed */
+            
+            return 1;                                                            /* return error */
+        }
+    }
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      write only the config registers that differ from the chip
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  *config pointer to a config structure
+ * @param[out] *written pointer to a written bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sync config failed
+ *             - 2 handle, config or written is NULL
+ *             - 3 handle is not initialized
+ *             - 4 tap detection threshold > 31
+ * @note       spcnt to pd are read in one burst, the differing registers are written in auto increment runs
+ *             with at most one standby and one active transition, 0 bytes are written when the chip already matches
+ */
+uint8_t mma7660fc_sync_config(mma7660fc_handle_t *handle, const mma7660fc_config_t *config, uint8_t *written)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t start;
+    uint8_t mode;
+    uint8_t standby;
+    uint8_t buf[6];
+    uint8_t chip[6];
+    
+    if ((handle == NULL) || (config == NULL) || (written == NULL))               /* check handle, config and written */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (handle->inited != 1)                                                     /* check handle initialization */
+    {
+        return 3;                                                                /* return error */
+    }
+    if (config->tap_detection_threshold > 31)                                    /* check the threshold */
+    {
+        handle->debug_print("mma7660fc: threshold > 31.\n");                     /* threshold > 31 */
         
-        return 4;                                                             /* return error */
+        return 4;                                                                /* return error */
     }
-    if (handle->iic_deinit() != 0)                                            /* iic deinit */
+    
+    *written = 0;                                                                /* clear written */
+    handle->shadow_valid = 0;                                                    /* flag invalid */
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SPCNT, chip, 6);            /* read spcnt to pd */
+    if (res != 0)                                                                /* check the result */
     {
-        handle->debug_print("mma7660fc: iic deinit failed.\n");               /* iic deinit failed */
+        handle->debug_print("mma7660fc: read spcnt to pd failed.\n");            /* read spcnt to pd failed */
         
-        return 1;                                                             /* return error */
+        return 1;                                                                /* return error */
+    }
+    memcpy(handle->shadow, chip, 6);                                             /* update the shadow */
+    handle->shadow_valid = 1;                                                    /* flag valid */
+    a_mma7660fc_config_encode(config, buf);                                      /* encode the config */
+    if (memcmp(buf, chip, 6) == 0)                                               /* chip already matches */
+    {
+        return 0;                                                                /* success return 0 */
     }
-    handle->inited = 0;                                                       /* flag close */
     
-    return 0;                                                                 /* success return 0 */
+    mode = buf[2];                                                               /* save the target mode register */
+    standby = (uint8_t)(mode & ~(7 << 0));                                       /* target bits in standby */
+    if (((chip[2] & 0x07) != 0) && 
+        ((memcmp(buf, chip, 2) != 0) || (memcmp(&buf[3], &chip[3], 3) != 0) ||
+         ((chip[2] & ~(7 << 0)) != standby)))                                    /* active and config registers differ */
+    {
+        res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &standby, 1);    /* enter standby */
+        if (res != 0)                                                            /* check the result */
+        {
+            handle->debug_print("mma7660fc: write mode failed.\n");              /* write mode failed */
+            
+            return 1;                                                            /* return error */
+        }
+        (*written)++;                                                            /* count the byte */
+        chip[2] = standby;                                                       /* chip mode register */
+    }
+    for (i = 0; i < 6; )
+    {
+        if ((i == 2) || (buf[i] == chip[i]))                                     /* mode is last, skip the same */
+        {
+            i++;                                                                 /* next register */
+            
+            continue;                                                            /* skip */
+        }
+        start = i;                                                               /* run start */
+        while ((i < 6) && (i != 2) && (buf[i] != chip[i]))                       /* find the run end */
+        {
+            i++;                                                                 /* next register */
+        }
+        res = a_mma7660fc_reg_write(handle, (uint8_t)(MMA7660FC_REG_SPCNT + start), 
+                                    &buf[start], (uint16_t)(i - start));         /* write the run */
+        if (res != 0)                                                            /* check the result */
+        {
+            handle->debug_print("mma7660fc: write config failed.\n");            /* write config failed */
+            
+            return 1;                                                            /* return error */
+        }
+        *written = (uint8_t)(*written + i - start);                              /* count the bytes */
+    }
+    if (chip[2] != mode)                                                         /* mode register differs */
+    {
+        res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &mode, 1);       /* write mode */
+        if (res != 0)                                                            /* check the result */
+        {
+            handle->debug_print("mma7660fc: write mode failed.\n");              /* write mode failed */
+            
+            return 1;                                                            /* return error */
+        }
+        (*written)++;                                                            /* count the byte */
+    }
+    
+    return 0;                                                                    /* success return 0 */
 }
 
 /**
- * @brief      read the data
+ * @brief      capture the writable register image
  * @param[in]  *handle pointer to a mma7660fc handle structure
- * @param[out] *raw pointer to a raw pressure buffer
- * @param[out] *g pointer to a converted data buffer
+ * @param[out] *snapshot pointer to a snapshot structure
  * @return     status code
  *             - 0 success
- *             - 1 read failed
- *             - 2 handle is NULL
+ *             - 1 snapshot failed
+ *             - 2 handle or snapshot is NULL
  *             - 3 handle is not initialized
- *             - 4 data is invalid
- * @note       none
+ * @note       spcnt to pd are read from the chip in one burst
  */
-uint8_t mma7660fc_read(mma7660fc_handle_t *handle, int8_t raw[3], float g[3])
+uint8_t mma7660fc_snapshot(mma7660fc_handle_t *handle, mma7660fc_snapshot_t *snapshot)
 {
     uint8_t res;
-    uint8_t buf[3];
     
-    if (handle == NULL)                                                    /* check handle */
+    if ((handle == NULL) || (snapshot == NULL))                                  /* check handle and snapshot */
     {
-        return 2;                                                          /* return error */
+        return 2;                                                                /* return error */
     }
-    if (handle->inited != 1)                                               /* check handle initialization */
+    if (handle->inited != 1)                                                     /* check handle initialization */
     {
-        return 3;                                                          /* return error */
+        return 3;                                                                /* return error */
     }
     
-    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_XOUT, buf, 3);        /* read data */
-    if (res != 0)                                                          /* check the result */
+    handle->shadow_valid = 0;                                                    /* flag invalid */
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SPCNT, snapshot->reg, 6);   /* read spcnt to pd */
+    if (res != 0)                                                                /* check the result */
     {
-        handle->debug_print("mma7660fc: read data failed.\n");             /* read data failed */
+        handle->debug_print("mma7660fc: read spcnt to pd failed.\n");            /* read spcnt to pd failed */
         
-        return 1;                                                          /* return error */
+        return 1;                                                                /* return error */
+    }
+    memcpy(handle->shadow, snapshot->reg, 6);                                    /* update the shadow */
+    handle->shadow_valid = 1;                                                    /* flag valid */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     restore the writable register image
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *snapshot pointer to a snapshot structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 restore failed
+ *            - 2 handle or snapshot is NULL
+ *            - 3 handle is not initialized
+ *            - 4 verify failed
+ * @note      the chip enters standby, spcnt to pd are written in one burst, the mode is set last
+ *            and the image is verified with one burst read back
+ */
+uint8_t mma7660fc_restore(mma7660fc_handle_t *handle, const mma7660fc_snapshot_t *snapshot)
+{
+    uint8_t res;
+    uint8_t mode;
+    uint8_t buf[6];
+    
+    if ((handle == NULL) || (snapshot == NULL))                                  /* check handle and snapshot */
+    {
+        return 2;                                                                /* return error */
     }
-    buf[0] &= ~(1 << 7);                                                   /* clear bit 7 */
-    buf[1] &= ~(1 << 7);                                                   /* clear bit 7 */
-    buf[2] &= ~(1 << 7);                                                   /* clear bit 7 */
-    if ((buf[0] & (1 << 6)) != 0)                                          /* check alert bit */
+    if (handle->inited != 1)                                                     /* check handle initialization */
     {
-        handle->debug_print("mma7660fc: data is invalid.\n");              /* data is invalid */
+        return 3;                                                                /* return error */
+    }
+    
+    memcpy(buf, snapshot->reg, 6);                                               /* copy the image */
+    mode = buf[2] & 0x07;                                                        /* save the target mode */
+    buf[2] &= ~(7 << 0);                                                         /* keep standby during the burst */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &buf[2], 1);         /* enter standby, the chip state is unknown */
+    if (res != 0)                                                                /* check the result */
+    {
+        handle->debug_print("mma7660fc: write mode failed.\n");                  /* write mode failed */
         
-        return 4;                                                          /* return error */
+        return 1;                                                                /* return error */
     }
-    if ((buf[1] & (1 << 6)) != 0)                                          /* check alert bit */
+    res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_SPCNT, buf, 6);            /* write spcnt to pd */
+    if (res != 0)                                                                /* check the result */
     {
-        handle->debug_print("mma7660fc: data is invalid.\n");              /* data is invalid */
+        handle->debug_print("mma7660fc: write spcnt to pd failed.\n");           /* write spcnt to pd failed */
         
-        return 4;                                                          /* return error */
+        return 1;                                                                /* return error */
     }
-    if ((buf[2] & (1 << 6)) != 0)                                          /* check alert bit */
+    if (mode != 0)                                                               /* if not standby */
     {
-        handle->debug_print("mma7660fc: data is invalid.\n");              /* data is invalid */
+        buf[2] |= mode;                                                          /* set the target mode */
+        res = a_mma7660fc_reg_write(handle, MMA7660FC_REG_MODE, &buf[2], 1);     /* write mode */
+        if (res != 0)                                                            /* check the result */
+        {
+            handle->debug_print("mma7660fc: write mode failed.\n");              /* write mode failed */
+            
+            return 1;                                                            /* return error */
+        }
+    }
+    handle->shadow_valid = 0;                                                    /* flag invalid */
+    res = a_mma7660fc_iic_read(handle, MMA7660FC_REG_SPCNT, buf, 6);             /* read back spcnt to pd */
+    if (res != 0)                                                                /* check the result */
+    {
+        handle->debug_print("mma7660fc: read spcnt to pd failed.\n");            /* read spcnt to pd failed */
         
-        return 4;                                                          /* return error */
+        return 1;                                                                /* return error */
+    }
+    memcpy(handle->shadow, buf, 6);                                              /* update the shadow */
+    handle->shadow_valid = 1;                                                    /* flag valid */
+    if (memcmp(buf, snapshot->reg, 6) != 0)                                      /* check the image */
+    {
+        handle->debug_print("mma7660fc: verify failed.\n");                      /* verify failed */
+        
+        return 4;                                                                /* return error */
+    }
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the whole config
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get config failed
+ *             - 2 handle or config is NULL
+ *             - 3 handle is not initialized
+ * @note       spcnt to pd are read in one burst or from the shadow
+ */
+uint8_t mma7660fc_get_config(mma7660fc_handle_t *handle, mma7660fc_config_t *config)
+{
+    uint8_t res;
+    uint8_t buf[6];
+    
+    if ((handle == NULL) || (config == NULL))                                /* check handle and config */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+    
+    res = a_mma7660fc_reg_read(handle, MMA7660FC_REG_SPCNT, buf, 6);         /* read spcnt to pd */
+    if (res != 0)                                                            /* check the result */
+    {
+        handle->debug_print("mma7660fc: read spcnt to pd failed.\n");        /* read spcnt to pd failed */
+        
+        return 1;                                                            /* return error */
     }
+    a_mma7660fc_config_decode(buf, config);                                  /* decode the config */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     set the calibration
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *calibration pointer to a calibration structure, NULL disables the calibration
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 calibration is out of range
+ * @note      the read functions apply it with an integer multiply and shift,
+ *            the raw output keeps the uncalibrated code
+ */
+uint8_t mma7660fc_set_calibration(mma7660fc_handle_t *handle, const mma7660fc_calibration_t *calibration)
+{
+    uint8_t i;
     
-    if ((buf[0] & (1 << 5)) != 0)                                          /* check negative bit */
+    if (handle == NULL)                                                                  /* check handle */
     {
-        raw[0] = (int8_t)(buf[0] | (3 << 6));                              /* extend to bit 6 and 7 */
-        g[0] = (float)(raw[0] / 21.33f);                                   /* convert to real data */
+        return 2;                                                                        /* return error */
     }
-    else
+    if (handle->inited != 1)                                                             /* check handle initialization */
     {
-        raw[0] = (int8_t)buf[0];                                           /* copy data */
-        g[0] = (float)(raw[0] / 21.33f);                                   /* convert to real data */
+        return 3;                                                                        /* return error */
     }
-    if ((buf[1] & (1 << 5)) != 0)                                          /* check negative bit */
+    if (calibration == NULL)                                                             /* disable */
     {
-        raw[1] = (int8_t)(buf[1] | (3 << 6));                              /* extend to bit 6 and 7 */
-        g[1] = (float)(raw[1] / 21.33f);                                   /* convert to real data */
+        handle->calibration_enable = 0;                                                  /* disable calibration */
+        
+        return 0;                                                                        /* success return 0 */
     }
-    else
+    
+    for (i = 0; i < 3; i++)
     {
-        raw[1] = (int8_t)buf[1];                                           /* copy data */
-        g[1] = (float)(raw[1] / 21.33f);                                   /* convert to real data */
+        if ((calibration->offset[i] > MMA7660FC_CALIBRATION_OFFSET_MAX) || 
+            (calibration->offset[i] < -MMA7660FC_CALIBRATION_OFFSET_MAX) ||
+            (calibration->gain[i] < MMA7660FC_CALIBRATION_GAIN_MIN) ||
+            (calibration->gain[i] > MMA7660FC_CALIBRATION_GAIN_MAX))                     /* check range */
+        {
+            handle->debug_print("mma7660fc: calibration is out of range.\n");            /* calibration is out of range */
+            
+            return 4;                                                                    /* return error */
+        }
     }
-    if ((buf[2] & (1 << 5)) != 0)                                          /* check negative bit */
+    handle->calibration = *calibration;                                                  /* set calibration */
+    handle->calibration_enable = 1;                                                      /* enable calibration */
+    
+    return 0;                                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the calibration
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *calibration pointer to a calibration structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mma7660fc_get_calibration(mma7660fc_handle_t *handle, mma7660fc_calibration_t *calibration, mma7660fc_bool_t *enable)
+{
+    if (handle == NULL)                                                                  /* check handle */
     {
-        raw[2] = (int8_t)(buf[2] | (3 << 6));                              /* extend to bit 6 and 7 */
-        g[2] = (float)(raw[2] / 21.33f);                                   /* convert to real data */
+        return 2;                                                                        /* return error */
     }
-    else
+    if (handle->inited != 1)                                                             /* check handle initialization */
     {
-        raw[2] = (int8_t)buf[2];                                           /* copy data */
-        g[2] = (float)(raw[2] / 21.33f);                                   /* convert to real data */
+        return 3;                                                                        /* return error */
     }
     
-    return 0;                                                              /* success return 0 */
+    *calibration = handle->calibration;                                                  /* get calibration */
+    *enable = (mma7660fc_bool_t)(handle->calibration_enable);                            /* get enable */
+    
+    return 0;                                                                            /* success return 0 */
 }
 
 /**
@@ -2505,7 +4163,7 @@ uint8_t mma7660fc_set_reg(mma7660fc_handle_t *handle, uint8_t reg, uint8_t *buf,
         return 3;                                              /* return error */
     } 
 
-    return a_mma7660fc_iic_write(handle, reg, buf, len);       /* write register */
+    return a_mma7660fc_reg_write(handle, reg, buf, len);       /* write register */
 }
 
 /**
@@ -178,21 +178,166 @@ typedef enum
     MMA7660FC_TILT_DEBOUNCE_FILTER_8       = 0x07,        /**< 8 measurement samples at the rate */
 } mma7660fc_tilt_debounce_filter_t;
 
+/**
+ * @brief mma7660fc back front enumeration definition
+ */
+typedef enum
+{
+    MMA7660FC_BAFRO_UNKNOWN = 0x00,        /**< unknown condition of front or back */
+    MMA7660FC_BAFRO_FRONT   = 0x01,        /**< equipment is lying on its front */
+    MMA7660FC_BAFRO_BACK    = 0x02,        /**< equipment is lying on its back */
+} mma7660fc_bafro_t;
+
+/**
+ * @brief mma7660fc portrait landscape enumeration definition
+ */
+typedef enum
+{
+    MMA7660FC_POLA_UNKNOWN = 0x00,        /**< unknown condition of up or down or left or right */
+    MMA7660FC_POLA_LEFT    = 0x01,        /**< equipment is landscape mode to the left */
+    MMA7660FC_POLA_RIGHT   = 0x02,        /**< equipment is landscape mode to the right */
+    MMA7660FC_POLA_DOWN    = 0x05,        /**< equipment is standing vertically in inverted orientation */
+    MMA7660FC_POLA_UP      = 0x06,        /**< equipment is standing vertically in normal orientation */
+} mma7660fc_pola_t;
+
+/**
+ * @brief mma7660fc state structure definition
+ */
+typedef struct mma7660fc_state_s
+{
+    mma7660fc_bafro_t bafro;              /**< back front status */
+    mma7660fc_pola_t pola;                /**< portrait landscape status */
+    mma7660fc_bool_t tap;                 /**< tap detected */
+    mma7660fc_bool_t shake;               /**< shake detected */
+    mma7660fc_bool_t auto_sleep;          /**< auto sleep status */
+    mma7660fc_bool_t auto_wake_up;        /**< auto wake up status */
+} mma7660fc_state_t;
+
+/**
+ * @brief mma7660fc event mask definition
+ * @note  one bit per mma7660fc_status_t
+ */
+#define MMA7660FC_EVENT_MASK(STATUS)        ((uint16_t)(1U << (STATUS)))
+
+/**
+ * @brief mma7660fc event type number definition
+ */
+#define MMA7660FC_EVENT_TYPE_NUM            11
+
+/**
+ * @brief mma7660fc event structure definition
+ */
+typedef struct mma7660fc_event_s
+{
+    uint16_t mask;                        /**< set events, see MMA7660FC_EVENT_MASK */
+    mma7660fc_bafro_t bafro;              /**< back front status */
+    mma7660fc_pola_t pola;                /**< portrait landscape status */
+    mma7660fc_bool_t tap;                 /**< tap detected */
+    mma7660fc_bool_t shake;               /**< shake detected */
+    mma7660fc_bool_t alert;               /**< tilt was read during an update and is invalid */
+    mma7660fc_bool_t auto_sleep;          /**< auto sleep status */
+    mma7660fc_bool_t auto_wake_up;        /**< auto wake up status */
+    uint16_t count[MMA7660FC_EVENT_TYPE_NUM];        /**< occurrences per set event, more than 1 when coalesced */
+} mma7660fc_event_t;
+
+/**
+ * @brief mma7660fc iic vector structure definition
+ */
+typedef struct mma7660fc_iic_vector_s
+{
+    uint8_t addr;         /**< iic device write address */
+    uint8_t reg;          /**< iic register address */
+    uint8_t *buf;         /**< pointer to a data buffer */
+    uint16_t len;         /**< length of the data buffer */
+} mma7660fc_iic_vector_t;
+
+/**
+ * @brief mma7660fc calibration structure definition
+ * @note  calibrated count = (raw - offset / 256) * gain / 16384, 1g is still 21.33 counts
+ */
+typedef struct mma7660fc_calibration_s
+{
+    int16_t offset[3];        /**< offset in 1/256 count, -2048 - 2048 */
+    uint16_t gain[3];         /**< gain in 1/16384, 8192 - 32768 */
+} mma7660fc_calibration_t;
+
+/**
+ * @brief mma7660fc snapshot structure definition
+ */
+typedef struct mma7660fc_snapshot_s
+{
+    uint8_t reg[6];        /**< spcnt, intsu, mode, sr, pdet and pd register image */
+} mma7660fc_snapshot_t;
+
 /**
  * @brief mma7660fc handle structure definition
  */
 typedef struct mma7660fc_handle_s
 {
-    uint8_t (*iic_init)(void);                                                          /**< point to an iic_init function address */
-    uint8_t (*iic_deinit)(void);                                                        /**< point to an iic_deinit function address */
-    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);         /**< point to an iic_read function address */
-    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);        /**< point to an iic_write function address */
-    void (*receive_callback)(uint8_t type);                                             /**< point to a receive_callback function address */
-    void (*delay_ms)(uint32_t ms);                                                      /**< point to a delay_ms function address */
-    void (*debug_print)(const char *const fmt, ...);                                    /**< point to a debug_print function address */
-    uint8_t inited;                                                                     /**< inited flag */
+    uint8_t (*iic_init)(void *user_data);                                                                          /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void *user_data);                                                                        /**< point to an iic_deinit function address */
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data);                   /**< point to an iic_read function address */
+    uint8_t (*iic_write)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data);                  /**< point to an iic_write function address */
+    uint8_t (*iic_read_vector)(mma7660fc_iic_vector_t *vector, uint16_t num, void *user_data);                     /**< point to an iic_read_vector function address */
+    uint8_t (*iic_read_async)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                              void (*done)(void *context, uint8_t status), void *context, void *user_data);        /**< point to an iic_read_async function address */
+    void (*receive_callback)(uint8_t type, void *user_data);                                                       /**< point to a receive_callback function address */
+    void (*event_callback)(const mma7660fc_event_t *event, void *user_data);                                       /**< point to an event_callback function address */
+    void (*read_done_callback)(void *user_data);                                                                   /**< point to a read_done_callback function address */
+    void (*delay_ms)(uint32_t ms);                                                                                 /**< point to a delay_ms function address */
+    uint32_t (*get_time_ms)(void);                                                                                 /**< point to a get_time_ms function address */
+    void (*debug_print)(const char *const fmt, ...);                                                               /**< point to a debug_print function address */
+    void *user_data;                                                                                               /**< user data passed to the interface functions */
+    uint8_t inited;                                                                                                /**< inited flag */
+    uint8_t shadow[6];                                                                                             /**< spcnt to pd shadow register */
+    uint8_t shadow_enable;                                                                                         /**< shadow enable flag */
+    uint8_t shadow_valid;                                                                                          /**< shadow valid flag */
+    uint8_t alert_retry;                                                                                           /**< alert retry times */
+    uint32_t alert_retry_count;                                                                                    /**< alert retry counter */
+    uint8_t async_buf[3];                                                                                          /**< split-phase read buffer */
+    volatile uint8_t async_state;                                                                                  /**< split-phase read state, acquire and release access */
+    volatile uint8_t async_status;                                                                                 /**< split-phase read status */
+    uint16_t coalesce_interval[MMA7660FC_EVENT_TYPE_NUM];                                                          /**< min event interval in ms */
+    uint16_t coalesce_pending[MMA7660FC_EVENT_TYPE_NUM];                                                           /**< occurrences not delivered yet */
+    uint32_t coalesce_last[MMA7660FC_EVENT_TYPE_NUM];                                                              /**< last delivery time */
+    uint16_t coalesce_delivered;                                                                                   /**< delivered at least once mask */
+    uint16_t coalesce_holdoff;                                                                                     /**< interrupt source holdoff in ms */
+    uint32_t coalesce_holdoff_until[8];                                                                            /**< holdoff end time per intsu bit */
+    uint8_t coalesce_holdoff_intsu;                                                                                /**< intsu bits disabled by the holdoff */
+    mma7660fc_calibration_t calibration;                                                                           /**< calibration */
+    uint8_t calibration_enable;                                                                                    /**< calibration enable flag */
 } mma7660fc_handle_t;
 
+/**
+ * @brief mma7660fc config structure definition
+ */
+typedef struct mma7660fc_config_s
+{
+    uint8_t sleep_count;                                            /**< sleep count */
+    mma7660fc_bool_t front_back_interrupt;                          /**< front back interrupt */
+    mma7660fc_bool_t up_down_right_left_interrupt;                  /**< up down right left interrupt */
+    mma7660fc_bool_t tap_interrupt;                                 /**< tap interrupt */
+    mma7660fc_bool_t auto_sleep_interrupt;                          /**< auto sleep interrupt */
+    mma7660fc_bool_t update_interrupt;                              /**< update interrupt */
+    mma7660fc_bool_t shake_x_interrupt;                             /**< shake x interrupt */
+    mma7660fc_bool_t shake_y_interrupt;                             /**< shake y interrupt */
+    mma7660fc_bool_t shake_z_interrupt;                             /**< shake z interrupt */
+    mma7660fc_mode_t mode;                                          /**< chip mode */
+    mma7660fc_bool_t auto_wake_up;                                  /**< auto wake up */
+    mma7660fc_bool_t auto_sleep;                                    /**< auto sleep */
+    mma7660fc_sleep_counter_prescaler_t sleep_counter_prescaler;    /**< sleep counter prescaler */
+    mma7660fc_interrupt_pin_type_t interrupt_pin_type;              /**< interrupt pin type */
+    mma7660fc_interrupt_active_level_t interrupt_active_level;      /**< interrupt active level */
+    mma7660fc_auto_sleep_rate_t tap_detection_rate;                 /**< tap detection rate */
+    mma7660fc_auto_wake_rate_t auto_wake_rate;                      /**< auto wake rate */
+    mma7660fc_tilt_debounce_filter_t tilt_debounce_filter;          /**< tilt debounce filter */
+    uint8_t tap_detection_threshold;                                /**< tap detection threshold */
+    mma7660fc_bool_t tap_x_detection;                               /**< tap x detection */
+    mma7660fc_bool_t tap_y_detection;                               /**< tap y detection */
+    mma7660fc_bool_t tap_z_detection;                               /**< tap z detection */
+    uint8_t tap_pulse_debounce_count;                               /**< tap pulse debounce count */
+} mma7660fc_config_t;
+
 /**
  * @brief mma7660fc information structure definition
  */
@@ -260,6 +405,22 @@ typedef struct mma7660fc_info_s
  */
 #define DRIVER_MMA7660FC_LINK_IIC_WRITE(HANDLE, FUC)               (HANDLE)->iic_write = FUC
 
+/**
+ * @brief     link iic_read_vector function
+ * @param[in] HANDLE pointer to a mma7660fc handle structure
+ * @param[in] FUC pointer to an iic_read_vector function address
+ * @note      optional, when it is not linked each vector is read with iic_read
+ */
+#define DRIVER_MMA7660FC_LINK_IIC_READ_VECTOR(HANDLE, FUC)         (HANDLE)->iic_read_vector = FUC
+
+/**
+ * @brief     link iic_read_async function
+ * @param[in] HANDLE pointer to a mma7660fc handle structure
+ * @param[in] FUC pointer to an iic_read_async function address
+ * @note      optional, only needed by mma7660fc_read_start
+ */
+#define DRIVER_MMA7660FC_LINK_IIC_READ_ASYNC(HANDLE, FUC)          (HANDLE)->iic_read_async = FUC
+
 /**
  * @brief     link delay_ms function
  * @param[in] HANDLE pointer to a mma7660fc handle structure
@@ -268,6 +429,14 @@ typedef struct mma7660fc_info_s
  */
 #define DRIVER_MMA7660FC_LINK_DELAY_MS(HANDLE, FUC)                (HANDLE)->delay_ms = FUC
 
+/**
+ * @brief     link get_time_ms function
+ * @param[in] HANDLE pointer to a mma7660fc handle structure
+ * @param[in] FUC pointer to a get_time_ms function address
+ * @note      optional, the interrupt coalescing needs it
+ */
+#define DRIVER_MMA7660FC_LINK_GET_TIME_MS(HANDLE, FUC)             (HANDLE)->get_time_ms = FUC
+
 /**
  * @brief     link debug_print function
  * @param[in] HANDLE pointer to a mma7660fc handle structure
@@ -284,6 +453,30 @@ typedef struct mma7660fc_info_s
  */
 #define DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(HANDLE, FUC)        (HANDLE)->receive_callback = FUC
 
+/**
+ * @brief     link event_callback function
+ * @param[in] HANDLE pointer to a mma7660fc handle structure
+ * @param[in] FUC pointer to an event_callback function address
+ * @note      optional, when linked the irq handler runs it once per interrupt instead of receive_callback
+ */
+#define DRIVER_MMA7660FC_LINK_EVENT_CALLBACK(HANDLE, FUC)          (HANDLE)->event_callback = FUC
+
+/**
+ * @brief     link read_done_callback function
+ * @param[in] HANDLE pointer to a mma7660fc handle structure
+ * @param[in] FUC pointer to a read_done_callback function address
+ * @note      optional, it runs in the bus completion context
+ */
+#define DRIVER_MMA7660FC_LINK_READ_DONE_CALLBACK(HANDLE, FUC)      (HANDLE)->read_done_callback = FUC
+
+/**
+ * @brief     link user data
+ * @param[in] HANDLE pointer to a mma7660fc handle structure
+ * @param[in] DATA pointer to the user data passed to the interface functions
+ * @note      none
+ */
+#define DRIVER_MMA7660FC_LINK_USER_DATA(HANDLE, DATA)              (HANDLE)->user_data = DATA
+
 /**
  * @}
  */
@@ -313,10 +506,99 @@ uint8_t mma7660fc_info(mma7660fc_info_t *info);
  *            - 1 run failed
  *            - 2 handle is NULL
  *            - 3 handle is not initialized
- * @note      none
+ * @note      tilt and srst are read in one burst and decoded into one event, it is passed to
+ *            event_callback if linked, otherwise receive_callback runs once per set event
  */
 uint8_t mma7660fc_irq_handler(mma7660fc_handle_t *handle);
 
+/**
+ * @brief      irq handler with the data
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ * @note       for the update interrupt, xout to srst are read in one burst, so the sample and
+ *             the event come back together, the callbacks run before the data is decoded
+ */
+uint8_t mma7660fc_irq_handler_with_data(mma7660fc_handle_t *handle, int8_t raw[3], float g[3]);
+
+/**
+ * @brief     set the event coalescing interval
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] type event type
+ * @param[in] interval_ms min interval between two deliveries, 0 means no limit
+ * @return    status code
+ *            - 0 success
+ *            - 1 get_time_ms is null
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 type is invalid
+ * @note      events inside the interval are counted and delivered later as one event with the count
+ */
+uint8_t mma7660fc_set_coalesce_interval(mma7660fc_handle_t *handle, mma7660fc_status_t type, uint16_t interval_ms);
+
+/**
+ * @brief      get the event coalescing interval
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  type event type
+ * @param[out] *interval_ms pointer to an interval buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 type is invalid
+ * @note       none
+ */
+uint8_t mma7660fc_get_coalesce_interval(mma7660fc_handle_t *handle, mma7660fc_status_t type, uint16_t *interval_ms);
+
+/**
+ * @brief     set the interrupt source holdoff
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] holdoff_ms holdoff time, 0 means disable
+ * @return    status code
+ *            - 0 success
+ *            - 1 get_time_ms is null
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      a coalesced event disables its intsu source for the holdoff time,
+ *            every source has its own end time and a held off source is not extended,
+ *            the chip is put in standby for the intsu write
+ */
+uint8_t mma7660fc_set_coalesce_holdoff(mma7660fc_handle_t *handle, uint16_t holdoff_ms);
+
+/**
+ * @brief     flush the coalesced events
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the irq handler does the same on every interrupt, call it when
+ *            mma7660fc_get_coalesce_deadline expires or periodically, so a held off source
+ *            comes back even when no other source interrupts
+ */
+uint8_t mma7660fc_coalesce_update(mma7660fc_handle_t *handle);
+
+/**
+ * @brief      get the time to the next coalescing deadline
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *ms pointer to a time buffer, 0xFFFFFFFF means no deadline
+ * @return     status code
+ *             - 0 success
+ *             - 1 get_time_ms is null
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the deadline is the nearest pending delivery or holdoff end,
+ *             a one shot timer can call mma7660fc_coalesce_update at it instead of polling
+ */
+uint8_t mma7660fc_get_coalesce_deadline(mma7660fc_handle_t *handle, uint32_t *ms);
+
 /**
  * @brief     initialize the chip
  * @param[in] *handle pointer to a mma7660fc handle structure
@@ -357,6 +639,69 @@ uint8_t mma7660fc_deinit(mma7660fc_handle_t *handle);
  */
 uint8_t mma7660fc_read(mma7660fc_handle_t *handle, int8_t raw[3], float g[3]);
 
+/**
+ * @brief      read the data in mg
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *mg pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ * @note       integer only, no float operation is used
+ */
+uint8_t mma7660fc_read_mg(mma7660fc_handle_t *handle, int8_t raw[3], int16_t mg[3]);
+
+/**
+ * @brief      read the data with the tilt and the sleep state
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @param[out] *state pointer to a state structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ * @note       xout to srst are read in one burst
+ */
+uint8_t mma7660fc_read_with_state(mma7660fc_handle_t *handle, int8_t raw[3], float g[3], mma7660fc_state_t *state);
+
+/**
+ * @brief     start a split-phase read of the data
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read start failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 read is busy
+ *            - 5 iic_read_async is null
+ * @note      the bus completion runs read_done_callback if it is linked
+ */
+uint8_t mma7660fc_read_start(mma7660fc_handle_t *handle);
+
+/**
+ * @brief      complete a split-phase read of the data
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 data is invalid
+ *             - 5 read is busy
+ *             - 6 read is not started
+ * @note       the data is decoded as mma7660fc_read does,
+ *             the alert bit is not retried and the read can be started again
+ */
+uint8_t mma7660fc_read_complete(mma7660fc_handle_t *handle, int8_t raw[3], float g[3]);
+
 /**
  * @brief      get tilt status
  * @param[in]  *handle pointer to a mma7660fc handle structure
@@ -1021,6 +1366,203 @@ uint8_t mma7660fc_tap_pulse_debounce_convert_to_register(mma7660fc_handle_t *han
  */
 uint8_t mma7660fc_tap_pulse_debounce_convert_to_data(mma7660fc_handle_t *handle, uint8_t reg, float *ms);
 
+/**
+ * @brief     enable or disable the shadow register
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set shadow failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      enabling the shadow loads spcnt to pd in one burst read,
+ *            then the setters only write and the getters don't access the bus
+ */
+uint8_t mma7660fc_set_shadow(mma7660fc_handle_t *handle, mma7660fc_bool_t enable);
+
+/**
+ * @brief      get the shadow register status
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mma7660fc_get_shadow(mma7660fc_handle_t *handle, mma7660fc_bool_t *enable);
+
+/**
+ * @brief     reload the shadow register from the chip
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 shadow sync failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mma7660fc_shadow_sync(mma7660fc_handle_t *handle);
+
+/**
+ * @brief     invalidate the shadow register
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it after the chip lost power or was written by others,
+ *            the next access reloads the shadow in one burst read
+ */
+uint8_t mma7660fc_shadow_invalidate(mma7660fc_handle_t *handle);
+
+/**
+ * @brief     set the alert retry times
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] times retry times of each register
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      when the alert bit is set, only the offending register is read again,
+ *            0 means no retry and the read returns the invalid error at once
+ */
+uint8_t mma7660fc_set_alert_retry(mma7660fc_handle_t *handle, uint8_t times);
+
+/**
+ * @brief      get the alert retry times
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *times pointer to a retry times buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mma7660fc_get_alert_retry(mma7660fc_handle_t *handle, uint8_t *times);
+
+/**
+ * @brief      get the alert retry counter
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *count pointer to a counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the counter is the total number of the register read again
+ */
+uint8_t mma7660fc_get_alert_retry_counter(mma7660fc_handle_t *handle, uint32_t *count);
+
+/**
+ * @brief     clear the alert retry counter
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mma7660fc_clear_alert_retry_counter(mma7660fc_handle_t *handle);
+
+/**
+ * @brief     apply the whole config
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply config failed
+ *            - 2 handle or config is NULL
+ *            - 3 handle is not initialized
+ *            - 4 tap detection threshold > 31
+ * @note      the chip enters standby, spcnt to pd are written in one auto increment burst
+ *            and then the chip enters config->mode
+ */
+uint8_t mma7660fc_apply_config(mma7660fc_handle_t *handle, const mma7660fc_config_t *config);
+
+/**
+ * @brief      write only the config registers that differ from the chip
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  *config pointer to a config structure
+ * @param[out] *written pointer to a written bytes buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 sync config failed
+ *             - 2 handle, config or written is NULL
+ *             - 3 handle is not initialized
+ *             - 4 tap detection threshold > 31
+ * @note       spcnt to pd are read in one burst, the differing registers are written in auto increment runs
+ *             with at most one standby and one active transition, 0 bytes are written when the chip already matches
+ */
+uint8_t mma7660fc_sync_config(mma7660fc_handle_t *handle, const mma7660fc_config_t *config, uint8_t *written);
+
+/**
+ * @brief      capture the writable register image
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *snapshot pointer to a snapshot structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 snapshot failed
+ *             - 2 handle or snapshot is NULL
+ *             - 3 handle is not initialized
+ * @note       spcnt to pd are read from the chip in one burst
+ */
+uint8_t mma7660fc_snapshot(mma7660fc_handle_t *handle, mma7660fc_snapshot_t *snapshot);
+
+/**
+ * @brief     restore the writable register image
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *snapshot pointer to a snapshot structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 restore failed
+ *            - 2 handle or snapshot is NULL
+ *            - 3 handle is not initialized
+ *            - 4 verify failed
+ * @note      the chip enters standby, spcnt to pd are written in one burst, the mode is set last
+ *            and the image is verified with one burst read back
+ */
+uint8_t mma7660fc_restore(mma7660fc_handle_t *handle, const mma7660fc_snapshot_t *snapshot);
+
+/**
+ * @brief      get the whole config
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get config failed
+ *             - 2 handle or config is NULL
+ *             - 3 handle is not initialized
+ * @note       spcnt to pd are read in one burst or from the shadow
+ */
+uint8_t mma7660fc_get_config(mma7660fc_handle_t *handle, mma7660fc_config_t *config);
+
+/**
+ * @brief     set the calibration
+ * @param[in] *handle pointer to a mma7660fc handle structure
+ * @param[in] *calibration pointer to a calibration structure, NULL disables the calibration
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 calibration is out of range
+ * @note      the read functions apply it with an integer multiply and shift,
+ *            the raw output keeps the uncalibrated code
+ */
+uint8_t mma7660fc_set_calibration(mma7660fc_handle_t *handle, const mma7660fc_calibration_t *calibration);
+
+/**
+ * @brief      get the calibration
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[out] *calibration pointer to a calibration structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mma7660fc_get_calibration(mma7660fc_handle_t *handle, mma7660fc_calibration_t *calibration, mma7660fc_bool_t *enable);
+
 /**
  * @}
  */
@@ -0,0 +1,276 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_batch.c
+ * @brief     driver mma7660fc batch source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_batch.h"
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON)
+    #include <arm_neon.h>
+#endif
+
+/**
+ * @brief mma7660fc batch decode definition
+ * @note  mg = (raw * 12002 + 128) >> 8 equals raw * 1000 / 21.33 rounded for all 6 bits codes
+ */
+#define MMA7660FC_BATCH_LSB_PER_G        21.33f        /**< lsb per g */
+#define MMA7660FC_BATCH_MG_MUL           12002         /**< mg multiplier */
+#define MMA7660FC_BATCH_MG_SHIFT         8             /**< mg shift */
+
+/**
+ * @brief      decode samples one by one
+ * @param[in]  *buf pointer to packed register images
+ * @param[in]  num sample number
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @param[out] *mg pointer to a converted data buffer in mg
+ * @param[out] *valid pointer to a valid flag buffer
+ * @return     invalid sample number
+ * @note       none
+ */
+static uint32_t a_mma7660fc_decode_scalar(const uint8_t *buf, uint32_t num, int8_t *raw, 
+                                          float *g, int16_t *mg, uint8_t *valid)
+{
+    uint32_t i;
+    uint32_t invalid;
+    
+    invalid = 0;
+    for (i = 0; i < num * 3; i++)
+    {
+        raw[i] = (int8_t)((int8_t)((buf[i] & 0x3F) ^ 0x20) - 0x20);                                /* sign extend */
+        if (g != NULL)
+        {
+            g[i] = (float)raw[i] / MMA7660FC_BATCH_LSB_PER_G;                                       /* convert to g */
+        }
+        if (mg != NULL)
+        {
+            mg[i] = (int16_t)((int32_t)((((uint32_t)(raw[i] + 128)) * MMA7660FC_BATCH_MG_MUL + 
+                              (1U << (MMA7660FC_BATCH_MG_SHIFT - 1))) >> MMA7660FC_BATCH_MG_SHIFT) - 
+                              (int32_t)((128 * MMA7660FC_BATCH_MG_MUL) >> MMA7660FC_BATCH_MG_SHIFT));  /* convert to mg */
+        }
+    }
+    for (i = 0; i < num; i++)
+    {
+        uint8_t ok = (uint8_t)(((buf[i * 3 + 0] | buf[i * 3 + 1] | buf[i * 3 + 2]) & (1 << 6)) == 0);  /* check alert bit */
+        
+        if (valid != NULL)
+        {
+            valid[i] = ok;                                                                           /* save the flag */
+        }
+        invalid += (uint32_t)(1 - ok);                                                               /* invalid++ */
+    }
+    
+    return invalid;
+}
+
+#if defined(__SSE2__)
+
+/**
+ * @brief      decode 16 samples with sse2
+ * @param[in]  *buf pointer to 48 packed register bytes
+ * @param[out] *raw pointer to a 48 raw data buffer
+ * @param[out] *g pointer to a 48 converted data buffer
+ * @param[out] *mg pointer to a 48 converted data buffer in mg
+ * @return     alert mask of the 48 bytes, 0 means all samples are valid
+ * @note       none
+ */
+static uint64_t a_mma7660fc_decode_block(const uint8_t *buf, int8_t *raw, float *g, int16_t *mg)
+{
+    const __m128i code_mask = _mm_set1_epi8(0x3F);
+    const __m128i sign_bit = _mm_set1_epi8(0x20);
+    const __m128i alert_bit = _mm_set1_epi8(0x40);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mg_mul = _mm_set1_epi32((1 << 16) | MMA7660FC_BATCH_MG_MUL);
+    const __m128 lsb = _mm_set1_ps(MMA7660FC_BATCH_LSB_PER_G);
+    uint64_t alert;
+    int k;
+    
+    alert = 0;
+    for (k = 0; k < 3; k++)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + k * 16));
+        __m128i r = _mm_sub_epi8(_mm_xor_si128(_mm_and_si128(v, code_mask), sign_bit), sign_bit);       /* sign extend */
+        __m128i s8 = _mm_cmpgt_epi8(zero, r);
+        __m128i lo = _mm_unpacklo_epi8(r, s8);                                                          /* to int16 */
+        __m128i hi = _mm_unpackhi_epi8(r, s8);
+        
+        alert |= (uint64_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v, alert_bit), alert_bit)) << (k * 16);
+        _mm_storeu_si128((__m128i *)(raw + k * 16), r);
+        if (g != NULL)
+        {
+            __m128i s16lo = _mm_cmpgt_epi16(zero, lo);
+            __m128i s16hi = _mm_cmpgt_epi16(zero, hi);
+            
+            _mm_storeu_ps(g + k * 16 + 0, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, s16lo)), lsb));
+            _mm_storeu_ps(g + k * 16 + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, s16lo)), lsb));
+            _mm_storeu_ps(g + k * 16 + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, s16hi)), lsb));
+            _mm_storeu_ps(g + k * 16 + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, s16hi)), lsb));
+        }
+        if (mg != NULL)
+        {
+            const __m128i bias = _mm_set1_epi16(1 << (MMA7660FC_BATCH_MG_SHIFT - 1));
+            __m128i m0 = _mm_madd_epi16(_mm_unpacklo_epi16(lo, bias), mg_mul);                        /* raw * mul + bias */
+            __m128i m1 = _mm_madd_epi16(_mm_unpackhi_epi16(lo, bias), mg_mul);
+            __m128i m2 = _mm_madd_epi16(_mm_unpacklo_epi16(hi, bias), mg_mul);
+            __m128i m3 = _mm_madd_epi16(_mm_unpackhi_epi16(hi, bias), mg_mul);
+            
+            m0 = _mm_srai_epi32(m0, MMA7660FC_BATCH_MG_SHIFT);
+            m1 = _mm_srai_epi32(m1, MMA7660FC_BATCH_MG_SHIFT);
+            m2 = _mm_srai_epi32(m2, MMA7660FC_BATCH_MG_SHIFT);
+            m3 = _mm_srai_epi32(m3, MMA7660FC_BATCH_MG_SHIFT);
+            _mm_storeu_si128((__m128i *)(mg + k * 16 + 0), _mm_packs_epi32(m0, m1));
+            _mm_storeu_si128((__m128i *)(mg + k * 16 + 8), _mm_packs_epi32(m2, m3));
+        }
+    }
+    
+    return alert;
+}
+
+#elif defined(__ARM_NEON)
+
+/**
+ * @brief      decode 16 samples with neon
+ * @param[in]  *buf pointer to 48 packed register bytes
+ * @param[out] *raw pointer to a 48 raw data buffer
+ * @param[out] *g pointer to a 48 converted data buffer
+ * @param[out] *mg pointer to a 48 converted data buffer in mg
+ * @return     alert mask of the 48 bytes, 0 means all samples are valid
+ * @note       the g conversion needs the exact division of aarch64,
+ *             on 32 bits arm it falls back to the scalar division
+ */
+static uint64_t a_mma7660fc_decode_block(const uint8_t *buf, int8_t *raw, float *g, int16_t *mg)
+{
+    const uint8x16_t code_mask = vdupq_n_u8(0x3F);
+    const uint8x16_t sign_bit = vdupq_n_u8(0x20);
+    const uint8x16_t alert_bit = vdupq_n_u8(0x40);
+    uint64_t alert;
+    int k;
+    
+    alert = 0;
+    for (k = 0; k < 3; k++)
+    {
+        uint8x16_t v = vld1q_u8(buf + k * 16);
+        int8x16_t r = vsubq_s8(vreinterpretq_s8_u8(veorq_u8(vandq_u8(v, code_mask), sign_bit)), 
+                               vreinterpretq_s8_u8(sign_bit));                                         /* sign extend */
+        int16x8_t lo = vmovl_s8(vget_low_s8(r));                                                       /* to int16 */
+        int16x8_t hi = vmovl_s8(vget_high_s8(r));
+        uint64x2_t a = vreinterpretq_u64_u8(vandq_u8(v, alert_bit));
+        
+        alert |= ((vgetq_lane_u64(a, 0) | vgetq_lane_u64(a, 1)) != 0) ? ((uint64_t)0xFFFF << (k * 16)) : 0;
+        vst1q_s8(raw + k * 16, r);
+        if (g != NULL)
+        {
+#if defined(__aarch64__)
+            const float32x4_t lsb = vdupq_n_f32(MMA7660FC_BATCH_LSB_PER_G);
+            
+            vst1q_f32(g + k * 16 + 0, vdivq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(lo))), lsb));
+            vst1q_f32(g + k * 16 + 4, vdivq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(lo))), lsb));
+            vst1q_f32(g + k * 16 + 8, vdivq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(hi))), lsb));
+            vst1q_f32(g + k * 16 + 12, vdivq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(hi))), lsb));
+#else
+            int j;
+            
+            for (j = 0; j < 16; j++)
+            {
+                g[k * 16 + j] = (float)raw[k * 16 + j] / MMA7660FC_BATCH_LSB_PER_G;
+            }
+#endif
+        }
+        if (mg != NULL)
+        {
+            const int16x4_t mul = vdup_n_s16(MMA7660FC_BATCH_MG_MUL);
+            
+            vst1q_s16(mg + k * 16 + 0, vcombine_s16(vrshrn_n_s32(vmull_s16(vget_low_s16(lo), mul), MMA7660FC_BATCH_MG_SHIFT), 
+                                                    vrshrn_n_s32(vmull_s16(vget_high_s16(lo), mul), MMA7660FC_BATCH_MG_SHIFT)));
+            vst1q_s16(mg + k * 16 + 8, vcombine_s16(vrshrn_n_s32(vmull_s16(vget_low_s16(hi), mul), MMA7660FC_BATCH_MG_SHIFT), 
+                                                    vrshrn_n_s32(vmull_s16(vget_high_s16(hi), mul), MMA7660FC_BATCH_MG_SHIFT)));
+        }
+    }
+    
+    return alert;
+}
+
+#endif
+
+/**
+ * @brief      decode packed xout to zout register images
+ * @param[in]  *buf pointer to num packed 3 bytes register images
+ * @param[in]  num sample number
+ * @param[out] *raw pointer to a num * 3 raw data buffer
+ * @param[out] *g pointer to a num * 3 converted data buffer, NULL to skip
+ * @param[out] *mg pointer to a num * 3 converted data buffer in mg, NULL to skip
+ * @param[out] *valid pointer to a num valid flag buffer, NULL to skip
+ * @return     status code
+ *             - 0 success
+ *             - 1 some samples are invalid
+ *             - 2 buf or raw is NULL
+ * @note       every sample is decoded, a sample with the alert bit set gets valid 0,
+ *             g equals mma7660fc_read and mg equals mma7660fc_read_mg,
+ *             SSE2 or NEON is used when the compiler enables it
+ */
+uint8_t mma7660fc_decode_batch(const uint8_t *buf, uint32_t num, int8_t *raw, float *g, int16_t *mg, uint8_t *valid)
+{
+    uint32_t invalid;
+    
+    if ((buf == NULL) || (raw == NULL))                                                 /* check the buffer */
+    {
+        return 2;                                                                       /* return error */
+    }
+    
+    invalid = 0;                                                                        /* init 0 */
+#if defined(__SSE2__) || defined(__ARM_NEON)
+    while (num >= 16)                                                                   /* 16 samples per block */
+    {
+        if (a_mma7660fc_decode_block(buf, raw, g, mg) != 0)                             /* decode the block */
+        {
+            invalid += a_mma7660fc_decode_scalar(buf, 16, raw, NULL, NULL, valid);      /* find the invalid samples */
+        }
+        else if (valid != NULL)
+        {
+            memset(valid, 1, 16);                                                       /* all samples are valid */
+        }
+        buf += 48;                                                                      /* next block */
+        raw += 48;
+        g = (g != NULL) ? (g + 48) : NULL;
+        mg = (mg != NULL) ? (mg + 48) : NULL;
+        valid = (valid != NULL) ? (valid + 16) : NULL;
+        num -= 16;
+    }
+#endif
+    invalid += a_mma7660fc_decode_scalar(buf, num, raw, g, mg, valid);                  /* decode the tail */
+    
+    return (invalid != 0) ? 1 : 0;                                                      /* return the result */
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_batch.h
+ * @brief     driver mma7660fc batch header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_BATCH_H
+#define DRIVER_MMA7660FC_BATCH_H
+
+#include "driver_mma7660fc.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mma7660fc_batch_driver mma7660fc batch driver function
+ * @brief    mma7660fc batch driver modules
+ * @ingroup  mma7660fc_driver
+ * @{
+ */
+
+/**
+ * @brief      decode packed xout to zout register images
+ * @param[in]  *buf pointer to num packed 3 bytes register images
+ * @param[in]  num sample number
+ * @param[out] *raw pointer to a num * 3 raw data buffer
+ * @param[out] *g pointer to a num * 3 converted data buffer, NULL to skip
+ * @param[out] *mg pointer to a num * 3 converted data buffer in mg, NULL to skip
+ * @param[out] *valid pointer to a num valid flag buffer, NULL to skip
+ * @return     status code
+ *             - 0 success
+ *             - 1 some samples are invalid
+ *             - 2 buf or raw is NULL
+ * @note       every sample is decoded, a sample with the alert bit set gets valid 0,
+ *             g equals mma7660fc_read and mg equals mma7660fc_read_mg,
+ *             SSE2 or NEON is used when the compiler enables it
+ */
+uint8_t mma7660fc_decode_batch(const uint8_t *buf, uint32_t num, int8_t *raw, float *g, int16_t *mg, uint8_t *valid);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,373 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_calibration.c
+ * @brief     driver mma7660fc calibration source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_calibration.h"
+#include <math.h>
+
+/**
+ * @brief mma7660fc calibration definition
+ */
+#define MMA7660FC_CALIBRATION_MAGIC          0xA5          /**< blob magic */
+#define MMA7660FC_CALIBRATION_VERSION        0x01          /**< blob version */
+#define MMA7660FC_CALIBRATION_LSB_PER_G      21.33         /**< lsb per g */
+
+/**
+ * @brief     get the crc16 ccitt
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len buffer length
+ * @return    crc
+ * @note      polynomial 0x1021, init 0xFFFF
+ */
+static uint16_t a_mma7660fc_calibration_crc(const uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint8_t j;
+    uint16_t crc;
+    
+    crc = 0xFFFF;                                                                                   /* init */
+    for (i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)buf[i] << 8);                                                   /* xor the byte */
+        for (j = 0; j < 8; j++)
+        {
+            crc = (uint16_t)(((crc & 0x8000) != 0) ? ((crc << 1) ^ 0x1021) : (crc << 1));          /* shift */
+        }
+    }
+    
+    return crc;                                                                                     /* return the crc */
+}
+
+/**
+ * @brief         solve a linear system
+ * @param[in,out] *a pointer to a 6 x 7 augmented matrix
+ * @param[out]    *x pointer to a 6 solution buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 matrix is singular
+ * @note          gaussian elimination with partial pivoting
+ */
+static uint8_t a_mma7660fc_calibration_gauss(double a[6][7], double x[6])
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t k;
+    uint8_t p;
+    double t;
+    
+    for (i = 0; i < 6; i++)
+    {
+        p = i;
+        for (j = (uint8_t)(i + 1); j < 6; j++)
+        {
+            if (fabs(a[j][i]) > fabs(a[p][i]))                                                      /* find the pivot */
+            {
+                p = j;                                                                              /* save the row */
+            }
+        }
+        if (fabs(a[p][i]) < 1e-12)                                                                  /* check the pivot */
+        {
+            return 1;                                                                               /* return error */
+        }
+        for (k = 0; k < 7; k++)
+        {
+            t = a[i][k];                                                                            /* swap the rows */
+            a[i][k] = a[p][k];                                                                      /* swap the rows */
+            a[p][k] = t;                                                                            /* swap the rows */
+        }
+        for (j = (uint8_t)(i + 1); j < 6; j++)
+        {
+            t = a[j][i] / a[i][i];                                                                  /* get the factor */
+            for (k = i; k < 7; k++)
+            {
+                a[j][k] -= t * a[i][k];                                                             /* eliminate */
+            }
+        }
+    }
+    for (i = 6; i > 0; i--)
+    {
+        t = a[i - 1][6];                                                                            /* get the right side */
+        for (k = i; k < 6; k++)
+        {
+            t -= a[i - 1][k] * x[k];                                                                /* substitute */
+        }
+        x[i - 1] = t / a[i - 1][i - 1];                                                             /* get the unknown */
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      collect one static pose
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  samples averaged sample number
+ * @param[in]  interval_ms interval between two samples in ms
+ * @param[out] *pose pointer to a pose buffer in count
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle or pose is NULL
+ *             - 3 handle is not initialized
+ *             - 4 samples is 0
+ * @note       keep the chip still, samples with the alert bit are skipped
+ */
+uint8_t mma7660fc_calibration_collect(mma7660fc_handle_t *handle, uint16_t samples, uint32_t interval_ms, float pose[3])
+{
+    uint8_t res;
+    uint16_t i;
+    uint32_t invalid;
+    int32_t sum[3];
+    int8_t raw[3];
+    float g[3];
+    
+    if ((handle == NULL) || (pose == NULL))                                                         /* check handle and pose */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                                        /* check handle initialization */
+    {
+        return 3;                                                                                   /* return error */
+    }
+    if (samples == 0)                                                                               /* check samples */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    
+    sum[0] = 0;                                                                                     /* clear x */
+    sum[1] = 0;                                                                                     /* clear y */
+    sum[2] = 0;                                                                                     /* clear z */
+    invalid = 0;                                                                                    /* clear invalid */
+    for (i = 0; i < samples; )
+    {
+        res = mma7660fc_read(handle, raw, g);                                                       /* read one sample */
+        if (res == 4)                                                                               /* alert bit */
+        {
+            invalid++;                                                                              /* count it */
+            if (invalid > samples)                                                                  /* too many */
+            {
+                handle->debug_print("mma7660fc: too many invalid samples.\n");                     /* too many invalid samples */
+                
+                return 1;                                                                           /* return error */
+            }
+            continue;                                                                               /* skip it */
+        }
+        if (res != 0)                                                                               /* check the result */
+        {
+            handle->debug_print("mma7660fc: read failed.\n");                                      /* read failed */
+            
+            return 1;                                                                               /* return error */
+        }
+        sum[0] += raw[0];                                                                           /* add x */
+        sum[1] += raw[1];                                                                           /* add y */
+        sum[2] += raw[2];                                                                           /* add z */
+        i++;                                                                                        /* next sample */
+        if (interval_ms != 0)                                                                       /* check interval */
+        {
+            handle->delay_ms(interval_ms);                                                          /* wait the next sample */
+        }
+    }
+    pose[0] = (float)sum[0] / (float)samples;                                                       /* average x */
+    pose[1] = (float)sum[1] / (float)samples;                                                       /* average y */
+    pose[2] = (float)sum[2] / (float)samples;                                                       /* average z */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      solve the offset and the gain
+ * @param[in]  *pose pointer to a num * 3 pose buffer in count
+ * @param[in]  num pose number, at least 6
+ * @param[out] *calibration pointer to a calibration structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 solve failed
+ *             - 2 pose or calibration is NULL
+ *             - 4 num < 6
+ * @note       fits a x^2 + b y^2 + c z^2 + d x + e y + f z = 1 by least squares,
+ *             use the six +-x, +-y and +-z up orientations or more poses spread over the sphere
+ */
+uint8_t mma7660fc_calibration_solve(const float *pose, uint16_t num, mma7660fc_calibration_t *calibration)
+{
+    uint16_t n;
+    uint8_t i;
+    uint8_t j;
+    double a[6][7];
+    double row[6];
+    double p[6];
+    double offset[3];
+    double gain[3];
+    double k;
+    
+    if ((pose == NULL) || (calibration == NULL))                                                    /* check pose and calibration */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if (num < MMA7660FC_CALIBRATION_MIN_POSE)                                                       /* check num */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    
+    memset(a, 0, sizeof(a));                                                                        /* clear the matrix */
+    for (n = 0; n < num; n++)
+    {
+        for (i = 0; i < 3; i++)
+        {
+            row[i] = (double)pose[n * 3 + i] * (double)pose[n * 3 + i];                             /* square term */
+            row[i + 3] = (double)pose[n * 3 + i];                                                   /* linear term */
+        }
+        for (i = 0; i < 6; i++)
+        {
+            for (j = 0; j < 6; j++)
+            {
+                a[i][j] += row[i] * row[j];                                                         /* normal matrix */
+            }
+            a[i][6] += row[i];                                                                      /* right side */
+        }
+    }
+    if (a_mma7660fc_calibration_gauss(a, p) != 0)                                                   /* solve */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    k = 1.0;                                                                                        /* right side after centering */
+    for (i = 0; i < 3; i++)
+    {
+        if (p[i] <= 0.0)                                                                            /* not an ellipsoid */
+        {
+            return 1;                                                                               /* return error */
+        }
+        offset[i] = -p[i + 3] / (2.0 * p[i]);                                                       /* center */
+        k += p[i] * offset[i] * offset[i];                                                          /* add the center term */
+    }
+    for (i = 0; i < 3; i++)
+    {
+        gain[i] = MMA7660FC_CALIBRATION_LSB_PER_G * sqrt(p[i] / k);                                 /* 1g maps to 21.33 counts */
+        if ((fabs(offset[i]) > 8.0) || (gain[i] < 0.5) || (gain[i] > 2.0))                         /* check range */
+        {
+            return 1;                                                                               /* return error */
+        }
+        calibration->offset[i] = (int16_t)floor(offset[i] * 256.0 + 0.5);                           /* to 1/256 count */
+        calibration->gain[i] = (uint16_t)floor(gain[i] * 16384.0 + 0.5);                            /* to 1/16384 */
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     save the calibration
+ * @param[in] *calibration pointer to a calibration structure
+ * @param[in] *write pointer to a blob write function
+ * @param[in] *user_data pointer to user data passed to the write function
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 calibration or write is NULL
+ * @note      the write function gets a MMA7660FC_CALIBRATION_BLOB_SIZE bytes blob
+ */
+uint8_t mma7660fc_calibration_save(const mma7660fc_calibration_t *calibration, 
+                                   uint8_t (*write)(const uint8_t *blob, uint16_t len, void *user_data),
+                                   void *user_data)
+{
+    uint8_t i;
+    uint16_t crc;
+    uint8_t blob[MMA7660FC_CALIBRATION_BLOB_SIZE];
+    
+    if ((calibration == NULL) || (write == NULL))                                                   /* check calibration and write */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    
+    blob[0] = MMA7660FC_CALIBRATION_MAGIC;                                                          /* set magic */
+    blob[1] = MMA7660FC_CALIBRATION_VERSION;                                                        /* set version */
+    for (i = 0; i < 3; i++)
+    {
+        blob[2 + i * 2] = (uint8_t)((uint16_t)calibration->offset[i] & 0xFF);                       /* offset low */
+        blob[3 + i * 2] = (uint8_t)((uint16_t)calibration->offset[i] >> 8);                         /* offset high */
+        blob[8 + i * 2] = (uint8_t)(calibration->gain[i] & 0xFF);                                   /* gain low */
+        blob[9 + i * 2] = (uint8_t)(calibration->gain[i] >> 8);                                     /* gain high */
+    }
+    crc = a_mma7660fc_calibration_crc(blob, MMA7660FC_CALIBRATION_BLOB_SIZE - 2);                   /* get crc */
+    blob[14] = (uint8_t)(crc & 0xFF);                                                               /* crc low */
+    blob[15] = (uint8_t)(crc >> 8);                                                                 /* crc high */
+    if (write(blob, MMA7660FC_CALIBRATION_BLOB_SIZE, user_data) != 0)                               /* write the blob */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      load the calibration
+ * @param[out] *calibration pointer to a calibration structure
+ * @param[in]  *read pointer to a blob read function
+ * @param[in]  *user_data pointer to user data passed to the read function
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 calibration or read is NULL
+ *             - 4 blob is invalid
+ * @note       the result is passed to mma7660fc_set_calibration
+ */
+uint8_t mma7660fc_calibration_load(mma7660fc_calibration_t *calibration, 
+                                   uint8_t (*read)(uint8_t *blob, uint16_t len, void *user_data),
+                                   void *user_data)
+{
+    uint8_t i;
+    uint16_t crc;
+    uint8_t blob[MMA7660FC_CALIBRATION_BLOB_SIZE];
+    
+    if ((calibration == NULL) || (read == NULL))                                                    /* check calibration and read */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    
+    if (read(blob, MMA7660FC_CALIBRATION_BLOB_SIZE, user_data) != 0)                                /* read the blob */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    crc = a_mma7660fc_calibration_crc(blob, MMA7660FC_CALIBRATION_BLOB_SIZE - 2);                   /* get crc */
+    if ((blob[0] != MMA7660FC_CALIBRATION_MAGIC) || (blob[1] != MMA7660FC_CALIBRATION_VERSION) ||
+        (blob[14] != (uint8_t)(crc & 0xFF)) || (blob[15] != (uint8_t)(crc >> 8)))                   /* check the blob */
+    {
+        return 4;                                                                                   /* return error */
+    }
+    for (i = 0; i < 3; i++)
+    {
+        calibration->offset[i] = (int16_t)(uint16_t)(blob[2 + i * 2] | (blob[3 + i * 2] << 8));     /* get offset */
+        calibration->gain[i] = (uint16_t)(blob[8 + i * 2] | (blob[9 + i * 2] << 8));                /* get gain */
+    }
+    
+    return 0;                                                                                       /* success return 0 */
+}
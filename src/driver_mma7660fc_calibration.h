@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_calibration.h
+ * @brief     driver mma7660fc calibration header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_CALIBRATION_H
+#define DRIVER_MMA7660FC_CALIBRATION_H
+
+#include "driver_mma7660fc.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mma7660fc_calibration_driver mma7660fc calibration driver function
+ * @brief    mma7660fc offset and gain calibration modules
+ * @ingroup  mma7660fc_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc calibration blob definition
+ * @note  magic, version, 3 offsets and 3 gains in little endian, crc16 ccitt
+ */
+#define MMA7660FC_CALIBRATION_BLOB_SIZE        16          /**< blob size in byte */
+#define MMA7660FC_CALIBRATION_MIN_POSE         6           /**< min pose number */
+
+/**
+ * @brief      collect one static pose
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  samples averaged sample number
+ * @param[in]  interval_ms interval between two samples in ms
+ * @param[out] *pose pointer to a pose buffer in count
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle or pose is NULL
+ *             - 3 handle is not initialized
+ *             - 4 samples is 0
+ * @note       keep the chip still, samples with the alert bit are skipped
+ */
+uint8_t mma7660fc_calibration_collect(mma7660fc_handle_t *handle, uint16_t samples, uint32_t interval_ms, float pose[3]);
+
+/**
+ * @brief      solve the offset and the gain
+ * @param[in]  *pose pointer to a num * 3 pose buffer in count
+ * @param[in]  num pose number, at least 6
+ * @param[out] *calibration pointer to a calibration structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 solve failed
+ *             - 2 pose or calibration is NULL
+ *             - 4 num < 6
+ * @note       fits a x^2 + b y^2 + c z^2 + d x + e y + f z = 1 by least squares,
+ *             use the six +-x, +-y and +-z up orientations or more poses spread over the sphere
+ */
+uint8_t mma7660fc_calibration_solve(const float *pose, uint16_t num, mma7660fc_calibration_t *calibration);
+
+/**
+ * @brief     save the calibration
+ * @param[in] *calibration pointer to a calibration structure
+ * @param[in] *write pointer to a blob write function
+ * @param[in] *user_data pointer to user data passed to the write function
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ *            - 2 calibration or write is NULL
+ * @note      the write function gets a MMA7660FC_CALIBRATION_BLOB_SIZE bytes blob
+ */
+uint8_t mma7660fc_calibration_save(const mma7660fc_calibration_t *calibration, 
+                                   uint8_t (*write)(const uint8_t *blob, uint16_t len, void *user_data),
+                                   void *user_data);
+
+/**
+ * @brief      load the calibration
+ * @param[out] *calibration pointer to a calibration structure
+ * @param[in]  *read pointer to a blob read function
+ * @param[in]  *user_data pointer to user data passed to the read function
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 calibration or read is NULL
+ *             - 4 blob is invalid
+ * @note       the result is passed to mma7660fc_set_calibration
+ */
+uint8_t mma7660fc_calibration_load(mma7660fc_calibration_t *calibration, 
+                                   uint8_t (*read)(uint8_t *blob, uint16_t len, void *user_data),
+                                   void *user_data);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,360 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_detect.c
+ * @brief     driver mma7660fc detect source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_detect.h"
+
+/**
+ * @brief mma7660fc detect fixed point definition
+ * @note  q8 = mg * 5461 / 1000 equals mg * 21.33 * 256 / 1000
+ */
+#define MMA7660FC_DETECT_Q8_MUL            5461        /**< 1/256 count per 1000 mg */
+#define MMA7660FC_DETECT_TAP_INVALID       0xFF        /**< pulse is not a tap */
+
+/**
+ * @brief     convert ms to samples
+ * @param[in] ms time in ms
+ * @param[in] rate sample rate
+ * @return    samples
+ * @note      none
+ */
+static uint32_t a_mma7660fc_detect_samples(uint16_t ms, uint16_t rate)
+{
+    return ((uint32_t)ms * rate + 500) / 1000;                                                      /* round to samples */
+}
+
+/**
+ * @brief     run the tap state machine of one axis
+ * @param[in] *detect pointer to a detect structure
+ * @param[in] *axis pointer to an axis structure
+ * @param[in] hp high-pass value in 1/256 count
+ * @return    0 no tap, 1 tap, 2 double tap
+ * @note      a pulse is a tap when it keeps its sign, ends within the duration and comes after the latency
+ */
+static uint8_t a_mma7660fc_detect_tap(mma7660fc_detect_t *detect, mma7660fc_detect_axis_t *axis, int32_t hp)
+{
+    int32_t mag;
+    uint8_t res;
+    
+    res = 0;
+    mag = (hp < 0) ? -hp : hp;                                                                      /* get magnitude */
+    if (axis->tap_since < 0xFFFF)                                                                   /* check the counter */
+    {
+        axis->tap_since++;                                                                          /* count samples */
+    }
+    if (mag > axis->tap_threshold)                                                                  /* above threshold */
+    {
+        if (axis->tap_above != MMA7660FC_DETECT_TAP_INVALID)                                        /* check the pulse */
+        {
+            if (axis->tap_above == 0)                                                               /* pulse starts */
+            {
+                axis->tap_sign = (hp < 0) ? -1 : 1;                                                 /* save the sign */
+                axis->tap_above = 1;                                                                /* count the pulse */
+            }
+            else if (axis->tap_sign != ((hp < 0) ? -1 : 1))                                         /* sign changes in the pulse */
+            {
+                axis->tap_above = MMA7660FC_DETECT_TAP_INVALID;                                     /* not a tap */
+            }
+            else if (axis->tap_above >= detect->tap_duration)                                       /* too long */
+            {
+                axis->tap_above = MMA7660FC_DETECT_TAP_INVALID;                                     /* not a tap */
+            }
+            else
+            {
+                axis->tap_above++;                                                                  /* count the pulse */
+            }
+        }
+    }
+    else if (axis->tap_above != 0)                                                                  /* pulse ends */
+    {
+        if ((axis->tap_above != MMA7660FC_DETECT_TAP_INVALID) &&
+            (axis->tap_since > detect->tap_latency) &&
+            (axis->shake_crossing == 0) && (axis->shake_quiet == 0))                                /* check the tap */
+        {
+            if ((axis->tap_pending != 0) && (axis->tap_since <= detect->tap_window))                /* second tap */
+            {
+                axis->tap_pending = 0;                                                              /* clear pending */
+                res = 2;                                                                            /* double tap */
+            }
+            else
+            {
+                axis->tap_pending = 1;                                                              /* set pending */
+                res = 1;                                                                            /* tap */
+            }
+            axis->tap_since = 0;                                                                    /* restart the counter */
+        }
+        axis->tap_above = 0;                                                                        /* clear the pulse */
+    }
+    else
+    {
+        if ((axis->tap_pending != 0) && (axis->tap_since > detect->tap_window))                     /* window is over */
+        {
+            axis->tap_pending = 0;                                                                  /* clear pending */
+        }
+    }
+    
+    return res;                                                                                     /* return the result */
+}
+
+/**
+ * @brief     run the shake state machine of one axis
+ * @param[in] *detect pointer to a detect structure
+ * @param[in] *axis pointer to an axis structure
+ * @param[in] hp high-pass value in 1/256 count
+ * @return    0 no shake, 1 shake
+ * @note      a shake is shake_count sign changes above the threshold within the window
+ */
+static uint8_t a_mma7660fc_detect_shake(mma7660fc_detect_t *detect, mma7660fc_detect_axis_t *axis, int32_t hp)
+{
+    int32_t mag;
+    int8_t sign;
+    
+    if (axis->shake_quiet != 0)                                                                     /* refractory */
+    {
+        axis->shake_quiet--;                                                                        /* count down */
+        
+        return 0;                                                                                   /* no shake */
+    }
+    if (axis->shake_crossing != 0)                                                                  /* in the window */
+    {
+        axis->shake_since++;                                                                        /* count samples */
+        if (axis->shake_since > detect->shake_window)                                               /* window is over */
+        {
+            axis->shake_crossing = 0;                                                               /* restart */
+            axis->shake_since = 0;                                                                  /* clear the counter */
+        }
+    }
+    mag = (hp < 0) ? -hp : hp;                                                                      /* get magnitude */
+    if (mag <= axis->shake_threshold)                                                               /* below threshold */
+    {
+        return 0;                                                                                   /* no shake */
+    }
+    sign = (hp < 0) ? -1 : 1;                                                                       /* get sign */
+    if ((axis->shake_sign != 0) && (sign != axis->shake_sign))                                      /* sign changes */
+    {
+        if (axis->shake_crossing == 0)                                                              /* first change */
+        {
+            axis->shake_since = 0;                                                                  /* open the window */
+        }
+        axis->shake_crossing++;                                                                     /* count the change */
+    }
+    axis->shake_sign = sign;                                                                        /* save the sign */
+    if (axis->shake_crossing >= detect->shake_count)                                                /* shake */
+    {
+        axis->shake_crossing = 0;                                                                   /* clear the changes */
+        axis->shake_since = 0;                                                                      /* clear the counter */
+        axis->shake_sign = 0;                                                                       /* clear the sign */
+        axis->shake_quiet = detect->shake_refractory;                                               /* start refractory */
+        
+        return 1;                                                                                   /* shake */
+    }
+    
+    return 0;                                                                                       /* no shake */
+}
+
+/**
+ * @brief      get the default detect config
+ * @param[out] *config pointer to a detect config structure
+ * @note       120 Hz, 750mg tap, 50ms duration, 100ms latency, 400ms double tap window,
+ *             800mg shake with 4 sign changes in 500ms and a 500ms refractory period
+ */
+void mma7660fc_detect_default_config(mma7660fc_detect_config_t *config)
+{
+    uint8_t i;
+    
+    if (config == NULL)                                                                             /* check config */
+    {
+        return;                                                                                     /* return */
+    }
+    
+    config->rate_hz = 120;                                                                          /* 120 Hz */
+    for (i = 0; i < 3; i++)
+    {
+        config->tap_threshold_mg[i] = 750;                                                          /* 750mg */
+        config->shake_threshold_mg[i] = 800;                                                        /* 800mg */
+    }
+    config->tap_duration_ms = 50;                                                                   /* 50ms */
+    config->tap_latency_ms = 100;                                                                   /* 100ms */
+    config->tap_window_ms = 400;                                                                    /* 400ms */
+    config->shake_count = 4;                                                                        /* 4 sign changes */
+    config->shake_window_ms = 500;                                                                  /* 500ms */
+    config->shake_refractory_ms = 500;                                                              /* 500ms */
+    config->high_pass_shift = 4;                                                                    /* 16 samples */
+}
+
+/**
+ * @brief     init the detector
+ * @param[in] *detect pointer to a detect structure
+ * @param[in] *config pointer to a detect config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 config is invalid
+ *            - 2 detect or config is NULL
+ * @note      times and thresholds are converted to samples and fixed point here, the push is integer only
+ */
+uint8_t mma7660fc_detect_init(mma7660fc_detect_t *detect, const mma7660fc_detect_config_t *config)
+{
+    uint8_t i;
+    uint32_t duration;
+    uint32_t latency;
+    uint32_t window;
+    uint32_t shake_window;
+    uint32_t refractory;
+    
+    if ((detect == NULL) || (config == NULL))                                                       /* check detect and config */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    if ((config->rate_hz == 0) || (config->high_pass_shift > 15) || (config->shake_count == 0))     /* check config */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    duration = a_mma7660fc_detect_samples(config->tap_duration_ms, config->rate_hz);                /* get duration */
+    latency = a_mma7660fc_detect_samples(config->tap_latency_ms, config->rate_hz);                  /* get latency */
+    window = a_mma7660fc_detect_samples(config->tap_window_ms, config->rate_hz);                    /* get window */
+    shake_window = a_mma7660fc_detect_samples(config->shake_window_ms, config->rate_hz);            /* get shake window */
+    refractory = a_mma7660fc_detect_samples(config->shake_refractory_ms, config->rate_hz);          /* get refractory */
+    if ((duration == 0) || (duration >= MMA7660FC_DETECT_TAP_INVALID) ||
+        (window >= 0xFFFF) || (latency >= 0xFFFF) ||
+        (shake_window == 0) || (shake_window > 0xFFFF) || (refractory > 0xFFFF))                    /* check range */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    
+    memset(detect, 0, sizeof(mma7660fc_detect_t));                                                  /* clear the state */
+    for (i = 0; i < 3; i++)
+    {
+        detect->axis[i].tap_threshold = (int32_t)(((uint32_t)config->tap_threshold_mg[i] * 
+                                        MMA7660FC_DETECT_Q8_MUL) / 1000);                           /* convert tap threshold */
+        detect->axis[i].shake_threshold = (int32_t)(((uint32_t)config->shake_threshold_mg[i] * 
+                                          MMA7660FC_DETECT_Q8_MUL) / 1000);                         /* convert shake threshold */
+        detect->axis[i].tap_since = 0xFFFF;                                                         /* no tap yet */
+    }
+    detect->tap_duration = (uint16_t)duration;                                                      /* set duration */
+    detect->tap_latency = (uint16_t)latency;                                                        /* set latency */
+    detect->tap_window = (uint16_t)window;                                                          /* set window */
+    detect->shake_window = (uint16_t)shake_window;                                                  /* set shake window */
+    detect->shake_refractory = (uint16_t)refractory;                                                /* set refractory */
+    detect->shake_count = config->shake_count;                                                      /* set shake count */
+    detect->shift = config->high_pass_shift;                                                        /* set shift */
+    
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     push one sample
+ * @param[in] *detect pointer to a detect structure
+ * @param[in] *raw pointer to a raw data buffer
+ * @return    detected events, see MMA7660FC_DETECT_TAP, MMA7660FC_DETECT_DOUBLE_TAP and MMA7660FC_DETECT_SHAKE
+ * @note      raw is the mma7660fc_read output, the second tap of a double tap reports only the double tap
+ */
+uint16_t mma7660fc_detect_push(mma7660fc_detect_t *detect, const int8_t raw[3])
+{
+    uint8_t i;
+    uint8_t tap;
+    uint16_t event;
+    int32_t v;
+    int32_t hp;
+    mma7660fc_detect_axis_t *axis;
+    
+    if (detect->primed == 0)                                                                        /* first sample */
+    {
+        for (i = 0; i < 3; i++)
+        {
+            detect->axis[i].base = (int32_t)raw[i] * 256;                                           /* set the baseline */
+        }
+        detect->primed = 1;                                                                         /* set primed */
+    }
+    
+    event = 0;
+    for (i = 0; i < 3; i++)
+    {
+        axis = &detect->axis[i];                                                                    /* get the axis */
+        v = (int32_t)raw[i] * 256;                                                                  /* to 1/256 count */
+        hp = v - axis->base;                                                                        /* remove gravity */
+        axis->base += hp / (1 << detect->shift);                                                    /* track the baseline */
+        tap = a_mma7660fc_detect_tap(detect, axis, hp);                                             /* run tap */
+        if (tap == 1)
+        {
+            event |= MMA7660FC_DETECT_TAP(i);                                                       /* set tap */
+        }
+        else if (tap == 2)
+        {
+            event |= MMA7660FC_DETECT_DOUBLE_TAP(i);                                                /* set double tap */
+        }
+        else
+        {
+            
+        }
+        if (a_mma7660fc_detect_shake(detect, axis, hp) != 0)                                        /* run shake */
+        {
+            event |= MMA7660FC_DETECT_SHAKE(i);                                                     /* set shake */
+        }
+    }
+    
+    return event;                                                                                   /* return the events */
+}
+
+/**
+ * @brief      push samples in a batch
+ * @param[in]  *detect pointer to a detect structure
+ * @param[in]  *raw pointer to a num * 3 raw data buffer
+ * @param[in]  num sample number
+ * @param[out] *event pointer to a num event buffer, NULL to skip
+ * @return     samples with an event
+ * @note       none
+ */
+uint32_t mma7660fc_detect_push_batch(mma7660fc_detect_t *detect, const int8_t *raw, uint32_t num, uint16_t *event)
+{
+    uint32_t i;
+    uint32_t cnt;
+    uint16_t e;
+    
+    cnt = 0;
+    for (i = 0; i < num; i++)
+    {
+        e = mma7660fc_detect_push(detect, &raw[i * 3]);                                             /* push one sample */
+        if (e != 0)
+        {
+            cnt++;                                                                                  /* count the sample */
+        }
+        if (event != NULL)
+        {
+            event[i] = e;                                                                           /* save the events */
+        }
+    }
+    
+    return cnt;                                                                                     /* return the number */
+}
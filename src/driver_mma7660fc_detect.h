@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_detect.h
+ * @brief     driver mma7660fc detect header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_DETECT_H
+#define DRIVER_MMA7660FC_DETECT_H
+
+#include "driver_mma7660fc.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mma7660fc_detect_driver mma7660fc detect driver function
+ * @brief    mma7660fc software tap and shake detect modules
+ * @ingroup  mma7660fc_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc detect event definition
+ * @note  bit AXIS of a group is set for the x, y or z axis
+ */
+#define MMA7660FC_DETECT_TAP(AXIS)               ((uint16_t)(1U << (0 + (AXIS))))        /**< single tap */
+#define MMA7660FC_DETECT_DOUBLE_TAP(AXIS)        ((uint16_t)(1U << (3 + (AXIS))))        /**< double tap */
+#define MMA7660FC_DETECT_SHAKE(AXIS)             ((uint16_t)(1U << (6 + (AXIS))))        /**< shake */
+
+/**
+ * @brief mma7660fc detect config structure definition
+ */
+typedef struct mma7660fc_detect_config_s
+{
+    uint16_t rate_hz;                     /**< sample rate */
+    uint16_t tap_threshold_mg[3];         /**< tap high-pass threshold per axis */
+    uint16_t tap_duration_ms;             /**< max time above the tap threshold */
+    uint16_t tap_latency_ms;              /**< min quiet time after a tap before the next one */
+    uint16_t tap_window_ms;               /**< max time between the two taps of a double tap */
+    uint16_t shake_threshold_mg[3];       /**< shake high-pass threshold per axis */
+    uint8_t shake_count;                  /**< sign changes above the threshold for a shake */
+    uint16_t shake_window_ms;             /**< max time of the shake_count sign changes */
+    uint16_t shake_refractory_ms;         /**< no shake on the axis for this time after a shake */
+    uint8_t high_pass_shift;              /**< gravity baseline filter, time constant is 2^shift samples */
+} mma7660fc_detect_config_t;
+
+/**
+ * @brief mma7660fc detect axis structure definition
+ */
+typedef struct mma7660fc_detect_axis_s
+{
+    int32_t base;                         /**< gravity baseline in 1/256 count */
+    int32_t tap_threshold;                /**< tap threshold in 1/256 count */
+    int32_t shake_threshold;              /**< shake threshold in 1/256 count */
+    uint16_t tap_since;                   /**< samples since the last tap */
+    uint8_t tap_above;                    /**< samples above the tap threshold */
+    uint8_t tap_pending;                  /**< first tap of a double tap is seen */
+    int8_t tap_sign;                      /**< sign of the current pulse */
+    int8_t shake_sign;                    /**< last sign above the shake threshold */
+    uint8_t shake_crossing;               /**< sign changes in the window */
+    uint16_t shake_since;                 /**< samples since the first sign change */
+    uint16_t shake_quiet;                 /**< refractory samples left */
+} mma7660fc_detect_axis_t;
+
+/**
+ * @brief mma7660fc detect structure definition
+ */
+typedef struct mma7660fc_detect_s
+{
+    mma7660fc_detect_axis_t axis[3];      /**< axis state */
+    uint16_t tap_duration;                /**< tap duration in samples */
+    uint16_t tap_latency;                 /**< tap latency in samples */
+    uint16_t tap_window;                  /**< tap window in samples */
+    uint16_t shake_window;                /**< shake window in samples */
+    uint16_t shake_refractory;            /**< shake refractory in samples */
+    uint8_t shake_count;                  /**< shake sign changes */
+    uint8_t shift;                        /**< high-pass shift */
+    uint8_t primed;                       /**< baseline is set */
+} mma7660fc_detect_t;
+
+/**
+ * @brief      get the default detect config
+ * @param[out] *config pointer to a detect config structure
+ * @note       120 Hz, 750mg tap, 50ms duration, 100ms latency, 400ms double tap window,
+ *             800mg shake with 4 sign changes in 500ms and a 500ms refractory period
+ */
+void mma7660fc_detect_default_config(mma7660fc_detect_config_t *config);
+
+/**
+ * @brief     init the detector
+ * @param[in] *detect pointer to a detect structure
+ * @param[in] *config pointer to a detect config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 config is invalid
+ *            - 2 detect or config is NULL
+ * @note      times and thresholds are converted to samples and fixed point here, the push is integer only
+ */
+uint8_t mma7660fc_detect_init(mma7660fc_detect_t *detect, const mma7660fc_detect_config_t *config);
+
+/**
+ * @brief     push one sample
+ * @param[in] *detect pointer to a detect structure
+ * @param[in] *raw pointer to a raw data buffer
+ * @return    detected events, see MMA7660FC_DETECT_TAP, MMA7660FC_DETECT_DOUBLE_TAP and MMA7660FC_DETECT_SHAKE
+ * @note      raw is the mma7660fc_read output, the second tap of a double tap reports only the double tap
+ */
+uint16_t mma7660fc_detect_push(mma7660fc_detect_t *detect, const int8_t raw[3]);
+
+/**
+ * @brief      push samples in a batch
+ * @param[in]  *detect pointer to a detect structure
+ * @param[in]  *raw pointer to a num * 3 raw data buffer
+ * @param[in]  num sample number
+ * @param[out] *event pointer to a num event buffer, NULL to skip
+ * @return     samples with an event
+ * @note       none
+ */
+uint32_t mma7660fc_detect_push_batch(mma7660fc_detect_t *detect, const int8_t *raw, uint32_t num, uint16_t *event);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
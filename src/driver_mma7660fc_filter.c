@@ -0,0 +1,410 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_filter.c
+ * @brief     driver mma7660fc filter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_filter.h"
+
+/**
+ * @brief mma7660fc filter fixed point definition
+ * @note  a biased unsigned shift is a floor shift for |v| < 2^30 without the implementation defined signed shift
+ */
+#define MMA7660FC_FILTER_BIAS        0x40000000U        /**< shift bias */
+
+/**
+ * @brief     floor shift
+ * @param[in] v value, |v| < 2^30
+ * @param[in] shift shift bits
+ * @return    floor(v / 2^shift)
+ * @note      none
+ */
+static int32_t a_mma7660fc_filter_shift(int32_t v, uint8_t shift)
+{
+    return (int32_t)(((uint32_t)v + MMA7660FC_FILTER_BIAS) >> shift) - 
+           (int32_t)(MMA7660FC_FILTER_BIAS >> shift);                                           /* floor shift */
+}
+
+/**
+ * @brief     get the median of 3
+ * @param[in] a value a
+ * @param[in] b value b
+ * @param[in] c value c
+ * @return    median
+ * @note      none
+ */
+static int16_t a_mma7660fc_filter_median3(int16_t a, int16_t b, int16_t c)
+{
+    int16_t lo;
+    int16_t hi;
+    
+    lo = (a < b) ? a : b;                                                                       /* min of a and b */
+    hi = (a < b) ? b : a;                                                                       /* max of a and b */
+    hi = (hi < c) ? hi : c;                                                                     /* min of max and c */
+    
+    return (lo > hi) ? lo : hi;                                                                 /* return the median */
+}
+
+/**
+ * @brief         sort two values
+ * @param[in,out] *a pointer to the small value
+ * @param[in,out] *b pointer to the large value
+ * @note          branchless min and max
+ */
+static void a_mma7660fc_filter_sort(int16_t *a, int16_t *b)
+{
+    int16_t lo;
+    int16_t hi;
+    
+    lo = (*a < *b) ? *a : *b;                                                                   /* min */
+    hi = (*a < *b) ? *b : *a;                                                                   /* max */
+    *a = lo;                                                                                    /* set the small value */
+    *b = hi;                                                                                    /* set the large value */
+}
+
+/**
+ * @brief     get the median of 5
+ * @param[in] *h pointer to a 5 values buffer
+ * @return    median
+ * @note      7 compare and swap network
+ */
+static int16_t a_mma7660fc_filter_median5(const int16_t *h)
+{
+    int16_t p0;
+    int16_t p1;
+    int16_t p2;
+    int16_t p3;
+    int16_t p4;
+    
+    p0 = h[0];                                                                                  /* copy 0 */
+    p1 = h[1];                                                                                  /* copy 1 */
+    p2 = h[2];                                                                                  /* copy 2 */
+    p3 = h[3];                                                                                  /* copy 3 */
+    p4 = h[4];                                                                                  /* copy 4 */
+    a_mma7660fc_filter_sort(&p0, &p1);                                                          /* sort 0 and 1 */
+    a_mma7660fc_filter_sort(&p3, &p4);                                                          /* sort 3 and 4 */
+    a_mma7660fc_filter_sort(&p0, &p3);                                                          /* sort 0 and 3 */
+    a_mma7660fc_filter_sort(&p1, &p4);                                                          /* sort 1 and 4 */
+    a_mma7660fc_filter_sort(&p1, &p2);                                                          /* sort 1 and 2 */
+    a_mma7660fc_filter_sort(&p2, &p3);                                                          /* sort 2 and 3 */
+    a_mma7660fc_filter_sort(&p1, &p2);                                                          /* sort 1 and 2 */
+    
+    return p2;                                                                                  /* return the median */
+}
+
+/**
+ * @brief     add a stage
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] type stage type
+ * @param[in] length boxcar or median length
+ * @param[in] shift iir shift
+ * @return    status code
+ *            - 0 success
+ *            - 1 stages are full
+ * @note      none
+ */
+static uint8_t a_mma7660fc_filter_add(mma7660fc_filter_t *filter, mma7660fc_filter_type_t type, 
+                                      uint8_t length, uint8_t shift)
+{
+    mma7660fc_filter_stage_t *stage;
+    
+    if (filter->stage_num >= MMA7660FC_FILTER_MAX_STAGE)                                        /* check the stage number */
+    {
+        return 1;                                                                               /* return error */
+    }
+    
+    stage = &filter->stage[filter->stage_num];                                                  /* get the stage */
+    memset(stage, 0, sizeof(mma7660fc_filter_stage_t));                                         /* clear the stage */
+    stage->type = (uint8_t)type;                                                                /* set the type */
+    stage->length = length;                                                                     /* set the length */
+    stage->shift = shift;                                                                       /* set the shift */
+    stage->recip = (65536U + length / 2U) / ((length != 0) ? length : 1U);                      /* set the reciprocal */
+    filter->stage_num++;                                                                        /* add the stage */
+    filter->primed = 0;                                                                         /* refill the history */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     fill a stage with one value
+ * @param[in] *stage pointer to a stage structure
+ * @param[in] *v pointer to a value buffer in 1/256 count
+ * @note      the stage starts in the steady state of v
+ */
+static void a_mma7660fc_filter_prime(mma7660fc_filter_stage_t *stage, const int16_t v[3])
+{
+    uint8_t i;
+    uint8_t j;
+    
+    for (i = 0; i < 3; i++)
+    {
+        for (j = 0; j < MMA7660FC_FILTER_MAX_LENGTH; j++)
+        {
+            stage->history[i][j] = v[i];                                                        /* fill the history */
+        }
+        if (stage->type == (uint8_t)MMA7660FC_FILTER_TYPE_BOXCAR)                               /* boxcar */
+        {
+            stage->acc[i] = (int32_t)v[i] * stage->length;                                      /* set the sum */
+        }
+        else
+        {
+            stage->acc[i] = (int32_t)v[i] * 256;                                                /* set the iir state */
+        }
+    }
+    stage->pos = 0;                                                                             /* reset the position */
+}
+
+/**
+ * @brief         run a stage on samples in a batch
+ * @param[in]     *stage pointer to a stage structure
+ * @param[in,out] *v pointer to a num * 3 value buffer in 1/256 count
+ * @param[in]     num sample number
+ * @note          one stage runs over the whole buffer, so the type is checked once
+ */
+static void a_mma7660fc_filter_run_batch(mma7660fc_filter_stage_t *stage, int16_t *v, uint32_t num)
+{
+    uint32_t n;
+    uint8_t i;
+    uint8_t pos;
+    int32_t x;
+    
+    pos = stage->pos;                                                                           /* get the position */
+    if (stage->type == (uint8_t)MMA7660FC_FILTER_TYPE_BOXCAR)                                   /* boxcar */
+    {
+        for (n = 0; n < num; n++)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                x = v[n * 3 + i];                                                               /* get the value */
+                stage->acc[i] += x - stage->history[i][pos];                                    /* update the sum */
+                stage->history[i][pos] = (int16_t)x;                                            /* save the value */
+                v[n * 3 + i] = (int16_t)a_mma7660fc_filter_shift((int32_t)((uint32_t)stage->acc[i] * 
+                                                                 stage->recip) + 32768, 16);    /* sum / length */
+            }
+            pos = (uint8_t)((pos + 1 == stage->length) ? 0 : (pos + 1));                        /* next position */
+        }
+    }
+    else if (stage->type == (uint8_t)MMA7660FC_FILTER_TYPE_IIR)                                 /* iir */
+    {
+        for (n = 0; n < num; n++)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                stage->acc[i] += a_mma7660fc_filter_shift((int32_t)v[n * 3 + i] * 256 - stage->acc[i], 
+                                                          stage->shift);                        /* y += (x - y) / 2^shift */
+                v[n * 3 + i] = (int16_t)a_mma7660fc_filter_shift(stage->acc[i] + 128, 8);       /* round to 1/256 count */
+            }
+        }
+    }
+    else if (stage->length == 3)                                                                /* median 3 */
+    {
+        for (n = 0; n < num; n++)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                stage->history[i][pos] = v[n * 3 + i];                                          /* save the value */
+                v[n * 3 + i] = a_mma7660fc_filter_median3(stage->history[i][0], stage->history[i][1], 
+                                                          stage->history[i][2]);                /* median of 3 */
+            }
+            pos = (uint8_t)((pos + 1 == 3) ? 0 : (pos + 1));                                    /* next position */
+        }
+    }
+    else                                                                                        /* median 5 */
+    {
+        for (n = 0; n < num; n++)
+        {
+            for (i = 0; i < 3; i++)
+            {
+                stage->history[i][pos] = v[n * 3 + i];                                          /* save the value */
+                v[n * 3 + i] = a_mma7660fc_filter_median5(stage->history[i]);                   /* median of 5 */
+            }
+            pos = (uint8_t)((pos + 1 == 5) ? 0 : (pos + 1));                                    /* next position */
+        }
+    }
+    stage->pos = pos;                                                                           /* save the position */
+}
+
+/**
+ * @brief     init the filter with no stage
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      a filter with no stage outputs raw * 256
+ */
+uint8_t mma7660fc_filter_init(mma7660fc_filter_t *filter)
+{
+    if (filter == NULL)                                                                         /* check filter */
+    {
+        return 2;                                                                               /* return error */
+    }
+    
+    memset(filter, 0, sizeof(mma7660fc_filter_t));                                              /* clear the filter */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     add a moving average stage
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] length window length, 1 - 16
+ * @return    status code
+ *            - 0 success
+ *            - 1 length is invalid or stages are full
+ *            - 2 filter is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_filter_add_boxcar(mma7660fc_filter_t *filter, uint8_t length)
+{
+    if (filter == NULL)                                                                         /* check filter */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if ((length == 0) || (length > MMA7660FC_FILTER_MAX_LENGTH))                                /* check length */
+    {
+        return 1;                                                                               /* return error */
+    }
+    
+    return a_mma7660fc_filter_add(filter, MMA7660FC_FILTER_TYPE_BOXCAR, length, 0);             /* add the stage */
+}
+
+/**
+ * @brief     add a single pole iir stage
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] shift y += (x - y) / 2^shift, 1 - 8
+ * @return    status code
+ *            - 0 success
+ *            - 1 shift is invalid or stages are full
+ *            - 2 filter is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_filter_add_iir(mma7660fc_filter_t *filter, uint8_t shift)
+{
+    if (filter == NULL)                                                                         /* check filter */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if ((shift == 0) || (shift > MMA7660FC_FILTER_MAX_SHIFT))                                   /* check shift */
+    {
+        return 1;                                                                               /* return error */
+    }
+    
+    return a_mma7660fc_filter_add(filter, MMA7660FC_FILTER_TYPE_IIR, 0, shift);                 /* add the stage */
+}
+
+/**
+ * @brief     add a median stage
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] length 3 or 5 taps
+ * @return    status code
+ *            - 0 success
+ *            - 1 length is invalid or stages are full
+ *            - 2 filter is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_filter_add_median(mma7660fc_filter_t *filter, uint8_t length)
+{
+    if (filter == NULL)                                                                         /* check filter */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if ((length != 3) && (length != 5))                                                        /* check length */
+    {
+        return 1;                                                                               /* return error */
+    }
+    
+    return a_mma7660fc_filter_add(filter, MMA7660FC_FILTER_TYPE_MEDIAN, length, 0);             /* add the stage */
+}
+
+/**
+ * @brief     reset the filter state
+ * @param[in] *filter pointer to a filter structure
+ * @note      the stages are kept, the next sample fills the history
+ */
+void mma7660fc_filter_reset(mma7660fc_filter_t *filter)
+{
+    filter->primed = 0;                                                                         /* refill the history */
+}
+
+/**
+ * @brief      filter one sample
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to an output buffer in 1/256 count
+ * @note       raw is the mma7660fc_read output, the first sample fills the history of every stage
+ */
+void mma7660fc_filter_push(mma7660fc_filter_t *filter, const int8_t raw[3], int16_t out[3])
+{
+    (void)mma7660fc_filter_push_batch(filter, raw, 1, out);                                     /* filter one sample */
+}
+
+/**
+ * @brief      filter samples in a batch
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  *raw pointer to a num * 3 raw data buffer
+ * @param[in]  num sample number
+ * @param[out] *out pointer to a num * 3 output buffer in 1/256 count
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter, raw or out is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_filter_push_batch(mma7660fc_filter_t *filter, const int8_t *raw, uint32_t num, int16_t *out)
+{
+    uint32_t i;
+    uint8_t j;
+    
+    if ((filter == NULL) || (raw == NULL) || (out == NULL))                                     /* check the buffers */
+    {
+        return 2;                                                                               /* return error */
+    }
+    
+    for (i = 0; i < num * 3; i++)
+    {
+        out[i] = (int16_t)((int32_t)raw[i] * 256);                                              /* to 1/256 count */
+    }
+    if ((filter->primed == 0) && (num != 0))                                                    /* first sample */
+    {
+        for (j = 0; j < filter->stage_num; j++)
+        {
+            a_mma7660fc_filter_prime(&filter->stage[j], out);                                   /* fill the stage */
+        }
+        filter->primed = 1;                                                                     /* set primed */
+    }
+    for (j = 0; j < filter->stage_num; j++)
+    {
+        a_mma7660fc_filter_run_batch(&filter->stage[j], out, num);                              /* run the stage */
+    }
+    
+    return 0;                                                                                   /* success return 0 */
+}
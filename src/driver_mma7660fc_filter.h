@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_filter.h
+ * @brief     driver mma7660fc filter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_FILTER_H
+#define DRIVER_MMA7660FC_FILTER_H
+
+#include "driver_mma7660fc.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mma7660fc_filter_driver mma7660fc filter driver function
+ * @brief    mma7660fc fixed point streaming filter modules
+ * @ingroup  mma7660fc_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc filter definition
+ */
+#define MMA7660FC_FILTER_MAX_STAGE        4         /**< max stage number */
+#define MMA7660FC_FILTER_MAX_LENGTH       16        /**< max boxcar length */
+#define MMA7660FC_FILTER_MAX_SHIFT        8         /**< max iir shift */
+
+/**
+ * @brief mma7660fc filter type enumeration definition
+ */
+typedef enum
+{
+    MMA7660FC_FILTER_TYPE_BOXCAR  = 0x00,        /**< moving average */
+    MMA7660FC_FILTER_TYPE_IIR     = 0x01,        /**< single pole iir */
+    MMA7660FC_FILTER_TYPE_MEDIAN  = 0x02,        /**< 3 or 5 taps median */
+} mma7660fc_filter_type_t;
+
+/**
+ * @brief mma7660fc filter stage structure definition
+ */
+typedef struct mma7660fc_filter_stage_s
+{
+    int16_t history[3][MMA7660FC_FILTER_MAX_LENGTH];        /**< boxcar and median history per axis */
+    int32_t acc[3];                                         /**< boxcar sum or iir state per axis */
+    uint32_t recip;                                         /**< boxcar 65536 / length */
+    uint8_t type;                                           /**< stage type */
+    uint8_t length;                                         /**< boxcar or median length */
+    uint8_t shift;                                          /**< iir shift */
+    uint8_t pos;                                            /**< history position */
+} mma7660fc_filter_stage_t;
+
+/**
+ * @brief mma7660fc filter structure definition
+ * @note  samples are in 1/256 count between the stages and at the output
+ */
+typedef struct mma7660fc_filter_s
+{
+    mma7660fc_filter_stage_t stage[MMA7660FC_FILTER_MAX_STAGE];        /**< stages */
+    uint8_t stage_num;                                                  /**< stage number */
+    uint8_t primed;                                                     /**< history is filled */
+} mma7660fc_filter_t;
+
+/**
+ * @brief     init the filter with no stage
+ * @param[in] *filter pointer to a filter structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ * @note      a filter with no stage outputs raw * 256
+ */
+uint8_t mma7660fc_filter_init(mma7660fc_filter_t *filter);
+
+/**
+ * @brief     add a moving average stage
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] length window length, 1 - 16
+ * @return    status code
+ *            - 0 success
+ *            - 1 length is invalid or stages are full
+ *            - 2 filter is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_filter_add_boxcar(mma7660fc_filter_t *filter, uint8_t length);
+
+/**
+ * @brief     add a single pole iir stage
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] shift y += (x - y) / 2^shift, 1 - 8
+ * @return    status code
+ *            - 0 success
+ *            - 1 shift is invalid or stages are full
+ *            - 2 filter is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_filter_add_iir(mma7660fc_filter_t *filter, uint8_t shift);
+
+/**
+ * @brief     add a median stage
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] length 3 or 5 taps
+ * @return    status code
+ *            - 0 success
+ *            - 1 length is invalid or stages are full
+ *            - 2 filter is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_filter_add_median(mma7660fc_filter_t *filter, uint8_t length);
+
+/**
+ * @brief     reset the filter state
+ * @param[in] *filter pointer to a filter structure
+ * @note      the stages are kept, the next sample fills the history
+ */
+void mma7660fc_filter_reset(mma7660fc_filter_t *filter);
+
+/**
+ * @brief      filter one sample
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *out pointer to an output buffer in 1/256 count
+ * @note       raw is the mma7660fc_read output, the first sample fills the history of every stage
+ */
+void mma7660fc_filter_push(mma7660fc_filter_t *filter, const int8_t raw[3], int16_t out[3]);
+
+/**
+ * @brief      filter samples in a batch
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  *raw pointer to a num * 3 raw data buffer
+ * @param[in]  num sample number
+ * @param[out] *out pointer to a num * 3 output buffer in 1/256 count
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter, raw or out is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_filter_push_batch(mma7660fc_filter_t *filter, const int8_t *raw, uint32_t num, int16_t *out);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_ring.c
+ * @brief     driver mma7660fc ring source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_ring.h"
+
+/**
+ * @brief ring index access definition
+ * @note  gcc and clang use acquire and release atomics,
+ *        other compilers use volatile access which is enough for a single core mcu
+ */
+#if defined(__GNUC__)
+    #define MMA7660FC_RING_LOAD(p)            __atomic_load_n((p), __ATOMIC_ACQUIRE)            /**< load acquire */
+    #define MMA7660FC_RING_STORE(p, v)        __atomic_store_n((p), (v), __ATOMIC_RELEASE)      /**< store release */
+#else
+    #define MMA7660FC_RING_LOAD(p)            (*(p))                                            /**< volatile load */
+    #define MMA7660FC_RING_STORE(p, v)        (*(p) = (v))                                      /**< volatile store */
+#endif
+
+/**
+ * @brief     init the ring
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *buffer pointer to a sample buffer
+ * @param[in] size buffer size, must be a power of 2
+ * @return    status code
+ *            - 0 success
+ *            - 1 size is invalid
+ *            - 2 ring or buffer is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_ring_init(mma7660fc_ring_t *ring, mma7660fc_ring_sample_t *buffer, uint32_t size)
+{
+    if ((ring == NULL) || (buffer == NULL))                                  /* check ring */
+    {
+        return 2;                                                            /* return error */
+    }
+    if ((size == 0) || ((size & (size - 1)) != 0))                           /* check size */
+    {
+        return 1;                                                            /* return error */
+    }
+    
+    ring->buffer = buffer;                                                   /* set the buffer */
+    ring->mask = size - 1;                                                   /* set the mask */
+    ring->head = 0;                                                          /* init 0 */
+    ring->tail = 0;                                                          /* init 0 */
+    ring->overflow = 0;                                                      /* init 0 */
+    ring->read_error = 0;                                                    /* init 0 */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     push a sample
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring or sample is NULL
+ *            - 4 ring is full
+ * @note      producer only, a full ring drops the new sample and counts it as overflow
+ */
+uint8_t mma7660fc_ring_push(mma7660fc_ring_t *ring, const mma7660fc_ring_sample_t *sample)
+{
+    uint32_t head;
+    
+    if ((ring == NULL) || (sample == NULL))                                  /* check ring */
+    {
+        return 2;                                                            /* return error */
+    }
+    
+    head = ring->head;                                                       /* own counter */
+    if ((head - MMA7660FC_RING_LOAD(&ring->tail)) > ring->mask)              /* check full */
+    {
+        MMA7660FC_RING_STORE(&ring->overflow, ring->overflow + 1);           /* overflow++ */
+        
+        return 4;                                                            /* return error */
+    }
+    ring->buffer[head & ring->mask] = *sample;                               /* copy the sample */
+    MMA7660FC_RING_STORE(&ring->head, head + 1);                             /* publish the sample */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      read the data and push it
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  *ring pointer to a ring structure
+ * @param[in]  timestamp user timestamp
+ * @param[out] *mg pointer to a converted data buffer in mg, NULL to skip
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 ring is NULL
+ *             - 4 ring is full
+ * @note       producer only, it can be called from the update interrupt or the poll context,
+ *             mg is set even when the ring is full
+ */
+uint8_t mma7660fc_ring_read(mma7660fc_handle_t *handle, mma7660fc_ring_t *ring, uint32_t timestamp, int16_t mg[3])
+{
+    int8_t raw[3];
+    int16_t buf[3];
+    mma7660fc_ring_sample_t sample;
+    
+    if (ring == NULL)                                                        /* check ring */
+    {
+        return 2;                                                            /* return error */
+    }
+    
+    if (mma7660fc_read_mg(handle, raw, (mg != NULL) ? mg : buf) != 0)        /* read without float */
+    {
+        MMA7660FC_RING_STORE(&ring->read_error, ring->read_error + 1);       /* read error++ */
+        
+        return 1;                                                            /* return error */
+    }
+    sample.timestamp = timestamp;                                            /* set the timestamp */
+    sample.raw[0] = raw[0];                                                  /* set x */
+    sample.raw[1] = raw[1];                                                  /* set y */
+    sample.raw[2] = raw[2];                                                  /* set z */
+    sample.flags = 0;                                                        /* no flags */
+    
+    return mma7660fc_ring_push(ring, &sample);                               /* push the sample */
+}
+
+/**
+ * @brief     count a read error
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ * @note      producer only, for a producer which reads with its own function instead of mma7660fc_ring_read
+ */
+uint8_t mma7660fc_ring_add_read_error(mma7660fc_ring_t *ring)
+{
+    if (ring == NULL)                                                        /* check ring */
+    {
+        return 2;                                                            /* return error */
+    }
+    
+    MMA7660FC_RING_STORE(&ring->read_error, ring->read_error + 1);           /* read error++ */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      pop samples in a batch
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  max max sample number
+ * @param[out] *num pointer to a popped sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring, sample or num is NULL
+ * @note       consumer only
+ */
+uint8_t mma7660fc_ring_pop(mma7660fc_ring_t *ring, mma7660fc_ring_sample_t *sample, uint32_t max, uint32_t *num)
+{
+    uint32_t i;
+    uint32_t n;
+    uint32_t tail;
+    
+    if ((ring == NULL) || (sample == NULL) || (num == NULL))                 /* check ring */
+    {
+        return 2;                                                            /* return error */
+    }
+    
+    tail = ring->tail;                                                       /* own counter */
+    n = MMA7660FC_RING_LOAD(&ring->head) - tail;                             /* queued number */
+    if (n > max)                                                             /* limit the number */
+    {
+        n = max;
+    }
+    for (i = 0; i < n; i++)
+    {
+        sample[i] = ring->buffer[(tail + i) & ring->mask];                   /* copy the sample */
+    }
+    MMA7660FC_RING_STORE(&ring->tail, tail + n);                             /* release the slots */
+    *num = n;                                                                /* set the number */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the queued sample number
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *count pointer to a queued sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring or count is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_ring_count(mma7660fc_ring_t *ring, uint32_t *count)
+{
+    if ((ring == NULL) || (count == NULL))                                   /* check ring */
+    {
+        return 2;                                                            /* return error */
+    }
+    
+    *count = MMA7660FC_RING_LOAD(&ring->head) - MMA7660FC_RING_LOAD(&ring->tail);        /* queued number */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the ring counters
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *overflow pointer to a lost sample counter buffer
+ * @param[out] *read_error pointer to a read error counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring, overflow or read_error is NULL
+ * @note       the counters only increase, the consumer can compare two snapshots
+ */
+uint8_t mma7660fc_ring_get_counter(mma7660fc_ring_t *ring, uint32_t *overflow, uint32_t *read_error)
+{
+    if ((ring == NULL) || (overflow == NULL) || (read_error == NULL))        /* check ring */
+    {
+        return 2;                                                            /* return error */
+    }
+    
+    *overflow = MMA7660FC_RING_LOAD(&ring->overflow);                        /* get the overflow counter */
+    *read_error = MMA7660FC_RING_LOAD(&ring->read_error);                    /* get the read error counter */
+    
+    return 0;                                                                /* success return 0 */
+}
@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_ring.h
+ * @brief     driver mma7660fc ring header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_RING_H
+#define DRIVER_MMA7660FC_RING_H
+
+#include "driver_mma7660fc.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mma7660fc_ring_driver mma7660fc ring driver function
+ * @brief    mma7660fc single producer single consumer sample ring modules
+ * @ingroup  mma7660fc_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc ring sample structure definition
+ */
+typedef struct mma7660fc_ring_sample_s
+{
+    uint32_t timestamp;        /**< user timestamp */
+    int8_t raw[3];             /**< raw data */
+    uint8_t flags;             /**< user flags */
+} mma7660fc_ring_sample_t;
+
+/**
+ * @brief mma7660fc ring structure definition
+ */
+typedef struct mma7660fc_ring_s
+{
+    mma7660fc_ring_sample_t *buffer;        /**< sample buffer */
+    uint32_t mask;                          /**< buffer size - 1 */
+    volatile uint32_t head;                 /**< write counter, owned by the producer */
+    volatile uint32_t tail;                 /**< read counter, owned by the consumer */
+    volatile uint32_t overflow;             /**< lost sample counter, owned by the producer */
+    volatile uint32_t read_error;           /**< read error counter, owned by the producer */
+} mma7660fc_ring_t;
+
+/**
+ * @brief     init the ring
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *buffer pointer to a sample buffer
+ * @param[in] size buffer size, must be a power of 2
+ * @return    status code
+ *            - 0 success
+ *            - 1 size is invalid
+ *            - 2 ring or buffer is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_ring_init(mma7660fc_ring_t *ring, mma7660fc_ring_sample_t *buffer, uint32_t size);
+
+/**
+ * @brief     push a sample
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring or sample is NULL
+ *            - 4 ring is full
+ * @note      producer only, a full ring drops the new sample and counts it as overflow
+ */
+uint8_t mma7660fc_ring_push(mma7660fc_ring_t *ring, const mma7660fc_ring_sample_t *sample);
+
+/**
+ * @brief      read the data and push it
+ * @param[in]  *handle pointer to a mma7660fc handle structure
+ * @param[in]  *ring pointer to a ring structure
+ * @param[in]  timestamp user timestamp
+ * @param[out] *mg pointer to a converted data buffer in mg, NULL to skip
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 ring is NULL
+ *             - 4 ring is full
+ * @note       producer only, it can be called from the update interrupt or the poll context,
+ *             mg is set even when the ring is full
+ */
+uint8_t mma7660fc_ring_read(mma7660fc_handle_t *handle, mma7660fc_ring_t *ring, uint32_t timestamp, int16_t mg[3]);
+
+/**
+ * @brief     count a read error
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 ring is NULL
+ * @note      producer only, for a producer which reads with its own function instead of mma7660fc_ring_read
+ */
+uint8_t mma7660fc_ring_add_read_error(mma7660fc_ring_t *ring);
+
+/**
+ * @brief      pop samples in a batch
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *sample pointer to a sample buffer
+ * @param[in]  max max sample number
+ * @param[out] *num pointer to a popped sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring, sample or num is NULL
+ * @note       consumer only
+ */
+uint8_t mma7660fc_ring_pop(mma7660fc_ring_t *ring, mma7660fc_ring_sample_t *sample, uint32_t max, uint32_t *num);
+
+/**
+ * @brief      get the queued sample number
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *count pointer to a queued sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring or count is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_ring_count(mma7660fc_ring_t *ring, uint32_t *count);
+
+/**
+ * @brief      get the ring counters
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *overflow pointer to a lost sample counter buffer
+ * @param[out] *read_error pointer to a read error counter buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 ring, overflow or read_error is NULL
+ * @note       the counters only increase, the consumer can compare two snapshots
+ */
+uint8_t mma7660fc_ring_get_counter(mma7660fc_ring_t *ring, uint32_t *overflow, uint32_t *read_error);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
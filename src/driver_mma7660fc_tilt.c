@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_tilt.c
+ * @brief     driver mma7660fc tilt source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_tilt.h"
+#include <math.h>
+
+/**
+ * @brief mma7660fc tilt definition
+ */
+#define MMA7660FC_TILT_CENTI_DEGREE        5729.5779513082321        /**< 0.01 degree per rad */
+
+/**
+ * @brief     convert an angle to 0.01 degree
+ * @param[in] rad angle in rad
+ * @return    angle in 0.01 degree
+ * @note      none
+ */
+static int16_t a_mma7660fc_tilt_round(double rad)
+{
+    double v;
+    
+    v = rad * MMA7660FC_TILT_CENTI_DEGREE;                                                      /* to 0.01 degree */
+    
+    return (int16_t)((v < 0.0) ? (v - 0.5) : (v + 0.5));                                        /* round */
+}
+
+/**
+ * @brief     build the tilt tables
+ * @param[in] *tilt pointer to a tilt structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 tilt is NULL
+ * @note      libm is only used here, the structure is about 42 KB
+ */
+uint8_t mma7660fc_tilt_init(mma7660fc_tilt_t *tilt)
+{
+    int32_t y;
+    int32_t z;
+    int32_t x;
+    uint32_t s;
+    uint16_t n;
+    
+    if (tilt == NULL)                                                                           /* check tilt */
+    {
+        return 2;                                                                               /* return error */
+    }
+    
+    memset(tilt->rank, 0, sizeof(tilt->rank));                                                  /* clear the rank */
+    for (y = 0; y <= 32; y++)
+    {
+        for (z = 0; z <= 32; z++)
+        {
+            tilt->rank[y * y + z * z] = 1;                                                      /* mark the sum */
+        }
+    }
+    n = 0;
+    for (s = 0; s <= MMA7660FC_TILT_SUM_MAX; s++)
+    {
+        if (tilt->rank[s] != 0)                                                                 /* a used sum */
+        {
+            for (x = 0; x <= 32; x++)
+            {
+                tilt->pitch[x][n] = a_mma7660fc_tilt_round(atan2(-(double)x, sqrt((double)s))); /* set pitch */
+            }
+            tilt->rank[s] = n;                                                                  /* set the rank */
+            n++;                                                                                /* next rank */
+        }
+    }
+    for (y = -32; y < 32; y++)
+    {
+        for (z = -32; z < 32; z++)
+        {
+            tilt->roll[y + 32][z + 32] = a_mma7660fc_tilt_round(atan2((double)y, (double)z));   /* set roll */
+        }
+    }
+    tilt->inited = 1;                                                                           /* flag finish initialization */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      get pitch and roll of one sample
+ * @param[in]  *tilt pointer to a tilt structure
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *pitch pointer to a pitch buffer in 0.01 degree
+ * @param[out] *roll pointer to a roll buffer in 0.01 degree
+ * @note       raw is the mma7660fc_read output, the tilt must be inited
+ */
+void mma7660fc_tilt_angle(const mma7660fc_tilt_t *tilt, const int8_t raw[3], int16_t *pitch, int16_t *roll)
+{
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    int16_t p;
+    
+    x = raw[0];                                                                                 /* get x */
+    y = raw[1];                                                                                 /* get y */
+    z = raw[2];                                                                                 /* get z */
+    p = tilt->pitch[(x < 0) ? -x : x][tilt->rank[y * y + z * z]];                               /* look up pitch */
+    *pitch = (x < 0) ? (int16_t)(-p) : p;                                                       /* pitch is odd in x */
+    *roll = tilt->roll[y + 32][z + 32];                                                         /* look up roll */
+}
+
+/**
+ * @brief      get pitch and roll of samples in a batch
+ * @param[in]  *tilt pointer to a tilt structure
+ * @param[in]  *raw pointer to a num * 3 raw data buffer
+ * @param[in]  num sample number
+ * @param[out] *pitch pointer to a num pitch buffer in 0.01 degree
+ * @param[out] *roll pointer to a num roll buffer in 0.01 degree
+ * @return     status code
+ *             - 0 success
+ *             - 2 tilt, raw, pitch or roll is NULL
+ *             - 3 tilt is not inited
+ * @note       none
+ */
+uint8_t mma7660fc_tilt_angle_batch(const mma7660fc_tilt_t *tilt, const int8_t *raw, uint32_t num, 
+                                   int16_t *pitch, int16_t *roll)
+{
+    uint32_t i;
+    
+    if ((tilt == NULL) || (raw == NULL) || (pitch == NULL) || (roll == NULL))                   /* check the buffers */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (tilt->inited != 1)                                                                      /* check the tables */
+    {
+        return 3;                                                                               /* return error */
+    }
+    
+    for (i = 0; i < num; i++)
+    {
+        mma7660fc_tilt_angle(tilt, &raw[i * 3], &pitch[i], &roll[i]);                           /* look up one sample */
+    }
+    
+    return 0;                                                                                   /* success return 0 */
+}
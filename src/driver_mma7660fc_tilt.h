@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_tilt.h
+ * @brief     driver mma7660fc tilt header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_TILT_H
+#define DRIVER_MMA7660FC_TILT_H
+
+#include "driver_mma7660fc.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mma7660fc_tilt_driver mma7660fc tilt driver function
+ * @brief    mma7660fc table based pitch and roll modules
+ * @ingroup  mma7660fc_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc tilt table definition
+ * @note  y * y + z * z of the 6 bits codes takes 457 different values
+ */
+#define MMA7660FC_TILT_SUM_MAX          2048        /**< max y * y + z * z */
+#define MMA7660FC_TILT_RANK_NUM         457         /**< different y * y + z * z number */
+
+/**
+ * @brief mma7660fc tilt structure definition
+ * @note  angles are in 0.01 degree, pitch is atan2(-x, sqrt(y * y + z * z)) and roll is atan2(y, z)
+ */
+typedef struct mma7660fc_tilt_s
+{
+    int16_t roll[64][64];                                   /**< roll indexed by y + 32 and z + 32 */
+    int16_t pitch[33][MMA7660FC_TILT_RANK_NUM];             /**< pitch of -|x| indexed by |x| and the sum rank */
+    uint16_t rank[MMA7660FC_TILT_SUM_MAX + 1];              /**< rank indexed by y * y + z * z */
+    uint8_t inited;                                         /**< inited flag */
+} mma7660fc_tilt_t;
+
+/**
+ * @brief     build the tilt tables
+ * @param[in] *tilt pointer to a tilt structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 tilt is NULL
+ * @note      libm is only used here, the structure is about 42 KB
+ */
+uint8_t mma7660fc_tilt_init(mma7660fc_tilt_t *tilt);
+
+/**
+ * @brief      get pitch and roll of one sample
+ * @param[in]  *tilt pointer to a tilt structure
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *pitch pointer to a pitch buffer in 0.01 degree
+ * @param[out] *roll pointer to a roll buffer in 0.01 degree
+ * @note       raw is the mma7660fc_read output, the tilt must be inited
+ */
+void mma7660fc_tilt_angle(const mma7660fc_tilt_t *tilt, const int8_t raw[3], int16_t *pitch, int16_t *roll);
+
+/**
+ * @brief      get pitch and roll of samples in a batch
+ * @param[in]  *tilt pointer to a tilt structure
+ * @param[in]  *raw pointer to a num * 3 raw data buffer
+ * @param[in]  num sample number
+ * @param[out] *pitch pointer to a num pitch buffer in 0.01 degree
+ * @param[out] *roll pointer to a num roll buffer in 0.01 degree
+ * @return     status code
+ *             - 0 success
+ *             - 2 tilt, raw, pitch or roll is NULL
+ *             - 3 tilt is not inited
+ * @note       none
+ */
+uint8_t mma7660fc_tilt_angle_batch(const mma7660fc_tilt_t *tilt, const int8_t *raw, uint32_t num, 
+                                   int16_t *pitch, int16_t *roll);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_batch_test.c
+ * @brief     driver mma7660fc batch test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_batch_test.h"
+#include <time.h>
+
+/**
+ * @brief batch test definition
+ */
+#define MMA7660FC_BATCH_TEST_SAMPLES        4096        /**< 4096 samples */
+#define MMA7660FC_BATCH_TEST_LOOPS          100         /**< 100 loops per time */
+
+static uint8_t gs_buf[MMA7660FC_BATCH_TEST_SAMPLES * 3];          /**< register images */
+static int8_t gs_raw[MMA7660FC_BATCH_TEST_SAMPLES * 3];           /**< batch raw data */
+static float gs_g[MMA7660FC_BATCH_TEST_SAMPLES * 3];              /**< batch converted data */
+static int8_t gs_raw_check[MMA7660FC_BATCH_TEST_SAMPLES * 3];     /**< reference raw data */
+static float gs_g_check[MMA7660FC_BATCH_TEST_SAMPLES * 3];        /**< reference converted data */
+static uint8_t gs_valid[MMA7660FC_BATCH_TEST_SAMPLES];            /**< batch valid flags */
+static uint8_t gs_valid_check[MMA7660FC_BATCH_TEST_SAMPLES];      /**< reference valid flags */
+
+/**
+ * @brief      reference per-sample decode
+ * @param[in]  *buf pointer to a xout to zout buffer
+ * @param[out] *raw pointer to a raw data buffer
+ * @param[out] *g pointer to a converted data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 4 data is invalid
+ * @note       the per-sample logic of the original mma7660fc_read
+ */
+static uint8_t a_decode_reference(const uint8_t *buf, int8_t raw[3], float g[3])
+{
+    uint8_t i;
+    uint8_t b[3];
+    
+    for (i = 0; i < 3; i++)
+    {
+        b[i] = buf[i] & (uint8_t)(~(1 << 7));
+        if ((b[i] & (1 << 6)) != 0)
+        {
+            return 4;
+        }
+    }
+    for (i = 0; i < 3; i++)
+    {
+        if ((b[i] & (1 << 5)) != 0)
+        {
+            raw[i] = (int8_t)(b[i] | (3 << 6));
+            g[i] = (float)(raw[i] / 21.33f);
+        }
+        else
+        {
+            raw[i] = (int8_t)b[i];
+            g[i] = (float)(raw[i] / 21.33f);
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     batch decode test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t mma7660fc_batch_test(uint32_t times)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t seed;
+    clock_t start;
+    double ref_s;
+    double batch_s;
+    double samples;
+    
+    /* start batch test */
+    mma7660fc_interface_debug_print("mma7660fc: start batch test.\n");
+    
+    /* make the register images */
+    seed = 1;
+    for (i = 0; i < MMA7660FC_BATCH_TEST_SAMPLES * 3; i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        gs_buf[i] = (uint8_t)((seed >> 16) & 0x3F);
+        if (((seed >> 8) & 0xFF) == 0)
+        {
+            gs_buf[i] |= 1 << 6;
+        }
+    }
+    
+    /* check the result */
+    (void)mma7660fc_decode_batch(gs_buf, MMA7660FC_BATCH_TEST_SAMPLES, gs_raw, gs_g, NULL, gs_valid);
+    for (i = 0; i < MMA7660FC_BATCH_TEST_SAMPLES; i++)
+    {
+        gs_valid_check[i] = (uint8_t)(a_decode_reference(&gs_buf[i * 3], &gs_raw_check[i * 3], &gs_g_check[i * 3]) == 0);
+        if (gs_valid_check[i] != gs_valid[i])
+        {
+            mma7660fc_interface_debug_print("mma7660fc: valid check error.\n");
+            
+            return 1;
+        }
+        if (gs_valid[i] == 0)
+        {
+            continue;
+        }
+        for (j = 0; j < 3; j++)
+        {
+            if ((gs_raw_check[i * 3 + j] != gs_raw[i * 3 + j]) || (gs_g_check[i * 3 + j] != gs_g[i * 3 + j]))
+            {
+                mma7660fc_interface_debug_print("mma7660fc: decode check error.\n");
+                
+                return 1;
+            }
+        }
+    }
+    mma7660fc_interface_debug_print("mma7660fc: decode check ok.\n");
+    
+    /* per-sample decode */
+    start = clock();
+    for (i = 0; i < times * MMA7660FC_BATCH_TEST_LOOPS; i++)
+    {
+        for (j = 0; j < MMA7660FC_BATCH_TEST_SAMPLES; j++)
+        {
+            gs_valid_check[j] = (uint8_t)(a_decode_reference(&gs_buf[j * 3], &gs_raw_check[j * 3], &gs_g_check[j * 3]) == 0);
+        }
+    }
+    ref_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    
+    /* batch decode */
+    start = clock();
+    for (i = 0; i < times * MMA7660FC_BATCH_TEST_LOOPS; i++)
+    {
+        (void)mma7660fc_decode_batch(gs_buf, MMA7660FC_BATCH_TEST_SAMPLES, gs_raw, gs_g, NULL, gs_valid);
+    }
+    batch_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    
+    /* output */
+    samples = (double)times * MMA7660FC_BATCH_TEST_LOOPS * MMA7660FC_BATCH_TEST_SAMPLES;
+    if ((ref_s > 0.0) && (batch_s > 0.0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: per-sample decode %0.0f samples/s.\n", samples / ref_s);
+        mma7660fc_interface_debug_print("mma7660fc: batch decode %0.0f samples/s.\n", samples / batch_s);
+        mma7660fc_interface_debug_print("mma7660fc: speedup %0.2f.\n", ref_s / batch_s);
+    }
+    else
+    {
+        mma7660fc_interface_debug_print("mma7660fc: run time is too short, increase the times.\n");
+    }
+    
+    /* finish batch test */
+    mma7660fc_interface_debug_print("mma7660fc: finish batch test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_calibration_test.c
+ * @brief     driver mma7660fc calibration test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_calibration_test.h"
+#include <math.h>
+#include <time.h>
+
+/**
+ * @brief calibration test definition
+ */
+#define MMA7660FC_CALIBRATION_TEST_LOOPS        100000        /**< 100000 reads per time */
+
+static mma7660fc_handle_t gs_handle;                          /**< mma7660fc handle */
+static uint8_t gs_reg[3];                                     /**< xout to zout images */
+static uint8_t gs_blob[MMA7660FC_CALIBRATION_BLOB_SIZE];      /**< blob storage */
+static const double gs_offset[3] = {0.75, -1.25, 2.0};        /**< true offset in count */
+static const double gs_gain[3] = {1.05, 0.93, 1.10};          /**< true gain */
+
+/**
+ * @brief     fake iic init
+ * @param[in] *user_data pointer to user data
+ * @return    status code
+ *            - 0 success
+ * @note      the read fast path is checked on register images without a chip
+ */
+static uint8_t a_fake_iic_init(void *user_data)
+{
+    (void)user_data;
+    
+    return 0;
+}
+
+/**
+ * @brief      fake iic read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *user_data pointer to user data
+ * @return     status code
+ *             - 0 success
+ * @note       xout to zout come from gs_reg, other registers read 0
+ */
+static uint8_t a_fake_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data)
+{
+    uint16_t i;
+    
+    (void)addr;
+    (void)user_data;
+    for (i = 0; i < len; i++)
+    {
+        buf[i] = ((reg + i) < 3) ? gs_reg[reg + i] : 0;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     fake iic write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *user_data pointer to user data
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_fake_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data)
+{
+    (void)addr;
+    (void)reg;
+    (void)buf;
+    (void)len;
+    (void)user_data;
+    
+    return 0;
+}
+
+/**
+ * @brief     blob write
+ * @param[in] *blob pointer to a blob buffer
+ * @param[in] len blob length
+ * @param[in] *user_data pointer to user data
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_blob_write(const uint8_t *blob, uint16_t len, void *user_data)
+{
+    (void)user_data;
+    memcpy(gs_blob, blob, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      blob read
+ * @param[out] *blob pointer to a blob buffer
+ * @param[in]  len blob length
+ * @param[in]  *user_data pointer to user data
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_blob_read(uint8_t *blob, uint16_t len, void *user_data)
+{
+    (void)user_data;
+    memcpy(blob, gs_blob, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      make a measured pose
+ * @param[in]  ux gravity x
+ * @param[in]  uy gravity y
+ * @param[in]  uz gravity z
+ * @param[in]  noise max noise in count
+ * @param[in]  *seed pointer to a random seed
+ * @param[out] *pose pointer to a pose buffer in count
+ * @note       measured = gravity * 21.33 / gain + offset
+ */
+static void a_make_pose(double ux, double uy, double uz, double noise, uint32_t *seed, float pose[3])
+{
+    uint8_t i;
+    double u[3];
+    double n;
+    
+    n = sqrt(ux * ux + uy * uy + uz * uz);
+    u[0] = ux / n;
+    u[1] = uy / n;
+    u[2] = uz / n;
+    for (i = 0; i < 3; i++)
+    {
+        *seed = *seed * 1103515245U + 12345U;
+        pose[i] = (float)(u[i] * 21.33 / gs_gain[i] + gs_offset[i] + 
+                          noise * ((double)((*seed >> 16) & 0x3FF) / 511.5 - 1.0));
+    }
+}
+
+/**
+ * @brief     check a solved calibration
+ * @param[in] *calibration pointer to a calibration structure
+ * @param[in] offset_error max offset error in count
+ * @param[in] gain_error max gain error
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_check_calibration(const mma7660fc_calibration_t *calibration, double offset_error, double gain_error)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 3; i++)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: axis %d offset %0.3f gain %0.4f.\n", i,
+                                        calibration->offset[i] / 256.0, calibration->gain[i] / 16384.0);
+        if ((fabs(calibration->offset[i] / 256.0 - gs_offset[i]) > offset_error) ||
+            (fabs(calibration->gain[i] / 16384.0 - gs_gain[i]) > gain_error))
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  calibration test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t mma7660fc_calibration_test(void)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t seed;
+    int32_t code;
+    int8_t raw[3];
+    int16_t mg[3];
+    float g[3];
+    float pose[26 * 3];
+    double err_g;
+    double err_mg;
+    double plain_s;
+    double calibration_s;
+    clock_t start;
+    mma7660fc_calibration_t calibration;
+    mma7660fc_calibration_t check;
+    mma7660fc_bool_t enable;
+    static const int8_t dir[26][3] =
+    {
+        {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1},
+        {1, 1, 0}, {1, -1, 0}, {-1, 1, 0}, {-1, -1, 0}, {1, 0, 1}, {1, 0, -1}, {-1, 0, 1},
+        {-1, 0, -1}, {0, 1, 1}, {0, 1, -1}, {0, -1, 1}, {0, -1, -1}, {1, 1, 1}, {1, 1, -1},
+        {1, -1, 1}, {1, -1, -1}, {-1, 1, 1}, {-1, 1, -1}, {-1, -1, 1}, {-1, -1, -1},
+    };
+    
+    /* start calibration test */
+    mma7660fc_interface_debug_print("mma7660fc: start calibration test.\n");
+    
+    /* six orientations */
+    seed = 1;
+    for (i = 0; i < 6; i++)
+    {
+        a_make_pose(dir[i][0], dir[i][1], dir[i][2], 0.0, &seed, &pose[i * 3]);
+    }
+    res = mma7660fc_calibration_solve(pose, 6, &calibration);
+    if ((res != 0) || (a_check_calibration(&calibration, 1.0 / 256.0, 1.0 / 8192.0) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: six orientations check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: six orientations check ok.\n");
+    
+    /* 26 poses with +-0.25 count noise */
+    for (i = 0; i < 26; i++)
+    {
+        a_make_pose(dir[i][0], dir[i][1], dir[i][2], 0.25, &seed, &pose[i * 3]);
+    }
+    res = mma7660fc_calibration_solve(pose, 26, &calibration);
+    if ((res != 0) || (a_check_calibration(&calibration, 0.15, 0.015) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: n-pose check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: n-pose check ok.\n");
+    
+    /* too few poses */
+    if (mma7660fc_calibration_solve(pose, 5, &check) != 4)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: pose number check error.\n");
+        
+        return 1;
+    }
+    
+    /* save and load */
+    if ((mma7660fc_calibration_save(&calibration, a_blob_write, NULL) != 0) ||
+        (mma7660fc_calibration_load(&check, a_blob_read, NULL) != 0) ||
+        (memcmp(&check, &calibration, sizeof(check)) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: blob check error.\n");
+        
+        return 1;
+    }
+    gs_blob[5] ^= 0x01;
+    if (mma7660fc_calibration_load(&check, a_blob_read, NULL) != 4)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: blob crc check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: blob check ok.\n");
+    
+    /* link the register images */
+    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, a_fake_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, a_fake_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, a_fake_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, a_fake_iic_write);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_interface_delay_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&gs_handle, mma7660fc_interface_receive_callback);
+    res = mma7660fc_init(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* apply in the read path */
+    check.offset[0] = 4096;
+    check.gain[0] = 16384;
+    if (mma7660fc_set_calibration(&gs_handle, &check) != 4)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: range check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)mma7660fc_set_calibration(&gs_handle, &calibration);
+    (void)mma7660fc_get_calibration(&gs_handle, &check, &enable);
+    if ((enable != MMA7660FC_BOOL_TRUE) || (memcmp(&check, &calibration, sizeof(check)) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get calibration check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    err_g = 0.0;
+    err_mg = 0.0;
+    for (code = -32; code < 32; code++)
+    {
+        gs_reg[0] = (uint8_t)(code & 0x3F);
+        gs_reg[1] = (uint8_t)((-code - 1) & 0x3F);
+        gs_reg[2] = (uint8_t)((code / 2) & 0x3F);
+        if ((mma7660fc_read(&gs_handle, raw, g) != 0) || (mma7660fc_read_mg(&gs_handle, raw, mg) != 0))
+        {
+            mma7660fc_interface_debug_print("mma7660fc: read failed.\n");
+            (void)mma7660fc_deinit(&gs_handle);
+            
+            return 1;
+        }
+        for (i = 0; i < 3; i++)
+        {
+            double expect;
+            
+            expect = ((double)raw[i] - calibration.offset[i] / 256.0) * (calibration.gain[i] / 16384.0) / 21.33;
+            err_g = fmax(err_g, fabs(g[i] - expect));
+            err_mg = fmax(err_mg, fabs(mg[i] - expect * 1000.0));
+        }
+    }
+    mma7660fc_interface_debug_print("mma7660fc: calibrated read max error %0.5f g, %0.2f mg.\n", err_g, err_mg);
+    if ((err_g > 0.0002) || (err_mg > 0.7))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: calibrated read check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: calibrated read check ok.\n");
+    
+    /* read path cost */
+    (void)mma7660fc_set_calibration(&gs_handle, NULL);
+    start = clock();
+    for (i = 0; i < MMA7660FC_CALIBRATION_TEST_LOOPS; i++)
+    {
+        (void)mma7660fc_read(&gs_handle, raw, g);
+    }
+    plain_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    (void)mma7660fc_set_calibration(&gs_handle, &calibration);
+    start = clock();
+    for (i = 0; i < MMA7660FC_CALIBRATION_TEST_LOOPS; i++)
+    {
+        (void)mma7660fc_read(&gs_handle, raw, g);
+    }
+    calibration_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if ((plain_s > 0.0) && (calibration_s > 0.0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: read %0.0f samples/s, calibrated read %0.0f samples/s without bus time.\n",
+                                        MMA7660FC_CALIBRATION_TEST_LOOPS / plain_s, MMA7660FC_CALIBRATION_TEST_LOOPS / calibration_s);
+    }
+    (void)mma7660fc_deinit(&gs_handle);
+    
+    /* finish calibration test */
+    mma7660fc_interface_debug_print("mma7660fc: finish calibration test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,343 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_coalesce_test.c
+ * @brief     driver mma7660fc coalesce test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_coalesce_test.h"
+#include "driver_mma7660fc_sim.h"
+
+/**
+ * @brief coalesce test definition
+ */
+#define MMA7660FC_COALESCE_TEST_INTERVAL        100        /**< 100ms event interval */
+#define MMA7660FC_COALESCE_TEST_HOLDOFF         200        /**< 200ms source holdoff */
+
+static mma7660fc_handle_t gs_handle;                         /**< mma7660fc handle */
+static mma7660fc_sim_t gs_sim;                               /**< simulated chip */
+static uint32_t gs_count[MMA7660FC_EVENT_TYPE_NUM];          /**< event counters */
+static uint32_t gs_callback;                                 /**< callback counter */
+
+/**
+ * @brief     event callback
+ * @param[in] *event pointer to an event structure
+ * @param[in] *user_data pointer to user data
+ * @note      the occurrences are counted per type
+ */
+static void a_event_callback(const mma7660fc_event_t *event, void *user_data)
+{
+    uint8_t i;
+    
+    (void)user_data;
+    gs_callback++;
+    for (i = 0; i < MMA7660FC_EVENT_TYPE_NUM; i++)
+    {
+        if ((event->mask & MMA7660FC_EVENT_MASK(i)) != 0)
+        {
+            gs_count[i] += event->count[i];
+        }
+    }
+}
+
+/**
+ * @brief      run the virtual clock and serve the interrupt
+ * @param[in]  ms time in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 irq handler failed
+ * @note       the active high interrupt pin is polled every 1ms
+ */
+static uint8_t a_sim_run_ms(uint32_t ms)
+{
+    uint32_t i;
+    uint8_t level;
+    
+    for (i = 0; i < ms; i++)
+    {
+        (void)mma7660fc_sim_advance(&gs_sim, 1000);
+        (void)mma7660fc_sim_get_interrupt(&gs_sim, &level);
+        if (level != 0)
+        {
+            if (mma7660fc_irq_handler(&gs_handle) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  read the chip intsu
+ * @return intsu register
+ * @note   none
+ */
+static uint8_t a_intsu(void)
+{
+    uint8_t intsu;
+    
+    intsu = 0;
+    (void)mma7660fc_get_reg(&gs_handle, 0x06, &intsu, 1);
+    
+    return intsu;
+}
+
+/**
+ * @brief      run until the chip intsu loses a source
+ * @param[in]  source intsu source bits
+ * @param[in]  ms max time in ms
+ * @param[out] *t pointer to a holdoff start time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 the source is still enabled
+ * @note       none
+ */
+static uint8_t a_wait_holdoff(uint8_t source, uint32_t ms, uint32_t *t)
+{
+    uint32_t i;
+    
+    for (i = 0; i < ms; i++)
+    {
+        if (a_sim_run_ms(1) != 0)
+        {
+            return 1;
+        }
+        if ((a_intsu() & source) == 0)
+        {
+            *t = mma7660fc_sim_get_time_ms();
+            
+            return 0;
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief  coalesce test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t mma7660fc_coalesce_test(void)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t now;
+    uint32_t deadline;
+    uint32_t shake_start;
+    uint32_t fb_start;
+    mma7660fc_config_t config;
+    mma7660fc_info_t info;
+    static const int16_t flat[3] = {0, 0, 1000};
+    static const int16_t back[3] = {0, 0, -1000};
+    static const int16_t shake[3] = {2000, 0, 1000};
+    
+    /* get mma7660fc info */
+    res = mma7660fc_info(&info);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print mma7660fc */
+        mma7660fc_interface_debug_print("mma7660fc: chip is %s.\n", info.chip_name);
+        mma7660fc_interface_debug_print("mma7660fc: manufacturer is %s.\n", info.manufacturer_name);
+        mma7660fc_interface_debug_print("mma7660fc: interface is %s.\n", info.interface);
+        mma7660fc_interface_debug_print("mma7660fc: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        mma7660fc_interface_debug_print("mma7660fc: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        mma7660fc_interface_debug_print("mma7660fc: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        mma7660fc_interface_debug_print("mma7660fc: max current is %0.2fmA.\n", info.max_current_ma);
+        mma7660fc_interface_debug_print("mma7660fc: max temperature is %0.1fC.\n", info.temperature_max);
+        mma7660fc_interface_debug_print("mma7660fc: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start coalesce test */
+    mma7660fc_interface_debug_print("mma7660fc: start coalesce test.\n");
+    
+    /* link the simulated chip */
+    (void)mma7660fc_sim_init(&gs_sim);
+    mma7660fc_sim_bind(&gs_sim);
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_sim_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_sim_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_sim_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_sim_iic_write);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_sim_delay_ms);
+    DRIVER_MMA7660FC_LINK_GET_TIME_MS(&gs_handle, mma7660fc_sim_get_time_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_EVENT_CALLBACK(&gs_handle, a_event_callback);
+    DRIVER_MMA7660FC_LINK_USER_DATA(&gs_handle, &gs_sim);
+    res = mma7660fc_init(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* shake x and front back at 64 samples/s, active high push-pull pin */
+    memset(&config, 0, sizeof(mma7660fc_config_t));
+    config.front_back_interrupt = MMA7660FC_BOOL_TRUE;
+    config.shake_x_interrupt = MMA7660FC_BOOL_TRUE;
+    config.mode = MMA7660FC_MODE_ACTIVE;
+    config.sleep_counter_prescaler = MMA7660FC_SLEEP_COUNTER_PRESCALER_1;
+    config.interrupt_pin_type = MMA7660FC_INTERRUPT_PIN_TYPE_PUSH_PULL;
+    config.interrupt_active_level = MMA7660FC_INTERRUPT_ACTIVE_LEVEL_HIGH;
+    config.tap_detection_rate = MMA7660FC_AUTO_SLEEP_RATE_64;
+    config.auto_wake_rate = MMA7660FC_AUTO_WAKE_RATE_8;
+    config.tilt_debounce_filter = MMA7660FC_TILT_DEBOUNCE_FILTER_DISABLE;
+    config.tap_detection_threshold = 31;
+    res = mma7660fc_apply_config(&gs_handle, &config);
+    res |= mma7660fc_set_coalesce_interval(&gs_handle, MMA7660FC_STATUS_SHAKE, MMA7660FC_COALESCE_TEST_INTERVAL);
+    res |= mma7660fc_set_coalesce_interval(&gs_handle, MMA7660FC_STATUS_FRONT, MMA7660FC_COALESCE_TEST_INTERVAL);
+    res |= mma7660fc_set_coalesce_interval(&gs_handle, MMA7660FC_STATUS_BACK, MMA7660FC_COALESCE_TEST_INTERVAL);
+    res |= mma7660fc_set_coalesce_holdoff(&gs_handle, MMA7660FC_COALESCE_TEST_HOLDOFF);
+    res |= a_sim_run_ms(300);
+    res |= mma7660fc_get_coalesce_deadline(&gs_handle, &deadline);
+    if ((res != 0) || (deadline != 0xFFFFFFFFU) || (a_intsu() != 0x81))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: config failed.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    memset(gs_count, 0, sizeof(gs_count));
+    gs_callback = 0;
+    
+    /* a front back storm holds off its source */
+    res = 1;
+    for (i = 0; (i < 10) && (res != 0); i++)
+    {
+        (void)mma7660fc_sim_set_accel(&gs_sim, ((i % 2) == 0) ? back : flat);
+        res = a_wait_holdoff(0x01, 20, &fb_start);
+    }
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    if ((res != 0) || ((a_intsu() & 0x81) != 0x80))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: front back storm check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: front back storm is held off at %dms.\n", fb_start);
+    
+    /* a later shake storm is delivered once and holds off its own source */
+    res = a_sim_run_ms(50);
+    (void)mma7660fc_sim_set_accel(&gs_sim, shake);
+    res |= a_wait_holdoff(0x80, 100, &shake_start);
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    now = mma7660fc_sim_get_time_ms();
+    if ((res != 0) || (gs_count[MMA7660FC_STATUS_SHAKE] != 1) || 
+        ((now - fb_start) >= MMA7660FC_COALESCE_TEST_HOLDOFF) || ((a_intsu() & 0x81) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: shake storm check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: shake storm is held off at %dms.\n", shake_start);
+    
+    /* the deadline is the nearer one of the pending deliveries and the front back holdoff end */
+    res = mma7660fc_get_coalesce_deadline(&gs_handle, &deadline);
+    if ((res != 0) || (deadline > fb_start + MMA7660FC_COALESCE_TEST_HOLDOFF - now))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: deadline check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: next deadline in %dms.\n", deadline);
+    
+    /* the front back source comes back at its own end time, the later shake storm does not extend it */
+    res = a_sim_run_ms(fb_start + MMA7660FC_COALESCE_TEST_HOLDOFF - mma7660fc_sim_get_time_ms());
+    res |= mma7660fc_coalesce_update(&gs_handle);
+    if ((res != 0) || ((a_intsu() & 0x81) != 0x01))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: front back holdoff end check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: front back source is back at %dms.\n", mma7660fc_sim_get_time_ms());
+    res = a_sim_run_ms(shake_start + MMA7660FC_COALESCE_TEST_HOLDOFF - mma7660fc_sim_get_time_ms());
+    res |= mma7660fc_coalesce_update(&gs_handle);
+    res |= mma7660fc_get_coalesce_deadline(&gs_handle, &deadline);
+    if ((res != 0) || (a_intsu() != 0x81) || (deadline != 0xFFFFFFFFU) || (gs_count[MMA7660FC_STATUS_SHAKE] < 2))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: shake holdoff end check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: shake source is back at %dms, %d shakes delivered.\n", 
+                                    mma7660fc_sim_get_time_ms(), gs_count[MMA7660FC_STATUS_SHAKE]);
+    
+    /* without update calls, the next interrupt of another source restores the held off one */
+    res = mma7660fc_set_coalesce_interval(&gs_handle, MMA7660FC_STATUS_FRONT, 0);
+    res |= mma7660fc_set_coalesce_interval(&gs_handle, MMA7660FC_STATUS_BACK, 0);
+    res |= a_sim_run_ms(MMA7660FC_COALESCE_TEST_INTERVAL);
+    (void)mma7660fc_sim_set_accel(&gs_sim, shake);
+    res |= a_wait_holdoff(0x80, 100, &shake_start);
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    res |= a_sim_run_ms(MMA7660FC_COALESCE_TEST_HOLDOFF + 50);
+    if ((res != 0) || ((a_intsu() & 0x80) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: shake storm check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)mma7660fc_sim_set_accel(&gs_sim, back);
+    res = a_sim_run_ms(50);
+    if ((res != 0) || (a_intsu() != 0x81))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: irq restore check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: the front back interrupt restores the shake source.\n");
+    (void)mma7660fc_deinit(&gs_handle);
+    
+    /* finish coalesce test */
+    mma7660fc_interface_debug_print("mma7660fc: finish coalesce test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_detect_test.c
+ * @brief     driver mma7660fc detect test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_detect_test.h"
+#include <time.h>
+
+/**
+ * @brief detect test definition
+ */
+#define MMA7660FC_DETECT_TEST_SAMPLES        4096        /**< 4096 samples, 34s at 120 Hz */
+#define MMA7660FC_DETECT_TEST_LOOPS          100         /**< 100 loops per time */
+#define MMA7660FC_DETECT_TEST_RATE           120         /**< 120 Hz */
+
+static int8_t gs_trace[MMA7660FC_DETECT_TEST_SAMPLES * 3];        /**< synthetic raw data */
+static uint16_t gs_event[MMA7660FC_DETECT_TEST_SAMPLES];          /**< detected events */
+
+/**
+ * @brief detect test expected event count, tap x y z, double tap x y z, shake x y z
+ */
+static const uint32_t gs_expect[9] = {2, 1, 2, 0, 1, 1, 1, 1, 0};
+
+/**
+ * @brief     add a tap pulse to the trace
+ * @param[in] axis tap axis
+ * @param[in] start first sample
+ * @param[in] amp pulse amplitude
+ * @note      the pulse lasts 2 samples
+ */
+static void a_detect_add_tap(uint8_t axis, uint32_t start, int8_t amp)
+{
+    gs_trace[start * 3 + axis] = (int8_t)(gs_trace[start * 3 + axis] + amp);
+    gs_trace[(start + 1) * 3 + axis] = (int8_t)(gs_trace[(start + 1) * 3 + axis] + amp);
+}
+
+/**
+ * @brief     add a shake to the trace
+ * @param[in] axis shake axis
+ * @param[in] start first sample
+ * @param[in] amp shake amplitude
+ * @note      a 20 Hz square wave lasting 24 samples
+ */
+static void a_detect_add_shake(uint8_t axis, uint32_t start, int8_t amp)
+{
+    uint32_t i;
+    
+    for (i = 0; i < 24; i++)
+    {
+        gs_trace[(start + i) * 3 + axis] = (int8_t)(gs_trace[(start + i) * 3 + axis] + 
+                                                    ((((i / 3) % 2) == 0) ? amp : -amp));
+    }
+}
+
+/**
+ * @brief     software detect test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t mma7660fc_detect_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    uint32_t seed;
+    uint32_t num;
+    uint32_t count[9];
+    clock_t start;
+    double s;
+    double samples;
+    mma7660fc_detect_config_t config;
+    mma7660fc_detect_t detect;
+    
+    /* start detect test */
+    mma7660fc_interface_debug_print("mma7660fc: start detect test.\n");
+    
+    /* make the trace, 1g on z with +-1 count noise */
+    seed = 1;
+    for (i = 0; i < MMA7660FC_DETECT_TEST_SAMPLES; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            seed = seed * 1103515245U + 12345U;
+            gs_trace[i * 3 + j] = (int8_t)((int32_t)((seed >> 16) % 3) - 1 + ((j == 2) ? 21 : 0));
+        }
+    }
+    a_detect_add_tap(0, 200, 20);
+    a_detect_add_tap(0, 600, 20);
+    a_detect_add_tap(1, 1000, 20);
+    a_detect_add_tap(1, 1020, 20);
+    a_detect_add_tap(2, 1400, -20);
+    a_detect_add_tap(2, 1420, -20);
+    a_detect_add_shake(1, 2000, 20);
+    a_detect_add_shake(0, 2600, 20);
+    a_detect_add_tap(2, 3200, -20);
+    
+    /* init */
+    mma7660fc_detect_default_config(&config);
+    config.rate_hz = MMA7660FC_DETECT_TEST_RATE;
+    res = mma7660fc_detect_init(&detect, &config);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: detect init failed.\n");
+        
+        return 1;
+    }
+    
+    /* check the events */
+    num = mma7660fc_detect_push_batch(&detect, gs_trace, MMA7660FC_DETECT_TEST_SAMPLES, gs_event);
+    memset(count, 0, sizeof(count));
+    for (i = 0; i < MMA7660FC_DETECT_TEST_SAMPLES; i++)
+    {
+        for (j = 0; j < 9; j++)
+        {
+            if ((gs_event[i] & (1U << j)) != 0)
+            {
+                count[j]++;
+            }
+        }
+    }
+    mma7660fc_interface_debug_print("mma7660fc: tap %d %d %d, double tap %d %d %d, shake %d %d %d in %d samples.\n",
+                                    count[0], count[1], count[2], count[3], count[4], count[5],
+                                    count[6], count[7], count[8], num);
+    for (j = 0; j < 9; j++)
+    {
+        if (count[j] != gs_expect[j])
+        {
+            mma7660fc_interface_debug_print("mma7660fc: event check error.\n");
+            
+            return 1;
+        }
+    }
+    mma7660fc_interface_debug_print("mma7660fc: event check ok.\n");
+    
+    /* check the bad config */
+    config.tap_duration_ms = 0;
+    if (mma7660fc_detect_init(&detect, &config) != 1)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: config check error.\n");
+        
+        return 1;
+    }
+    config.tap_duration_ms = 50;
+    (void)mma7660fc_detect_init(&detect, &config);
+    
+    /* run the detector */
+    start = clock();
+    for (i = 0; i < times * MMA7660FC_DETECT_TEST_LOOPS; i++)
+    {
+        (void)mma7660fc_detect_push_batch(&detect, gs_trace, MMA7660FC_DETECT_TEST_SAMPLES, gs_event);
+    }
+    s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    
+    /* output */
+    samples = (double)times * MMA7660FC_DETECT_TEST_LOOPS * MMA7660FC_DETECT_TEST_SAMPLES;
+    if (s > 0.0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: detect %0.0f samples/s.\n", samples / s);
+        mma7660fc_interface_debug_print("mma7660fc: %0.0f sensors per core at %d Hz.\n",
+                                        samples / s / MMA7660FC_DETECT_TEST_RATE, MMA7660FC_DETECT_TEST_RATE);
+    }
+    else
+    {
+        mma7660fc_interface_debug_print("mma7660fc: run time is too short, increase the times.\n");
+    }
+    
+    /* finish detect test */
+    mma7660fc_interface_debug_print("mma7660fc: finish detect test.\n");
+    
+    return 0;
+}
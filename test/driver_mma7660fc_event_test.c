@@ -0,0 +1,363 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_event_test.c
+ * @brief     driver mma7660fc event test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_event_test.h"
+#include "driver_mma7660fc_sim.h"
+
+static mma7660fc_handle_t gs_handle;        /**< mma7660fc handle */
+static mma7660fc_sim_t gs_sim;              /**< simulated chip */
+static uint8_t gs_tilt;                     /**< last tilt byte on the bus */
+static uint8_t gs_srst;                     /**< last srst byte on the bus */
+static uint8_t gs_error;                    /**< decode error flag */
+static uint16_t gs_mask;                    /**< collected event mask */
+static uint32_t gs_callback;                /**< callback counter */
+
+/**
+ * @brief      iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *user_data pointer to user data
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the tilt and srst bytes the chip returns are saved
+ */
+static uint8_t a_event_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data)
+{
+    if (mma7660fc_sim_iic_read(addr, reg, buf, len, user_data) != 0)
+    {
+        return 1;
+    }
+    if ((reg <= 0x03) && (reg + len > 0x03))
+    {
+        gs_tilt = buf[0x03 - reg];
+    }
+    if ((reg <= 0x04) && (reg + len > 0x04))
+    {
+        gs_srst = buf[0x04 - reg];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     event callback
+ * @param[in] *event pointer to an event structure
+ * @param[in] *user_data pointer to user data
+ * @note      every field is checked against the tilt and srst bytes read by the irq handler
+ */
+static void a_event_callback(const mma7660fc_event_t *event, void *user_data)
+{
+    uint8_t pola;
+    uint16_t mask;
+    
+    (void)user_data;
+    
+    /* the expected mask from the datasheet bit layout */
+    mask = 0;
+    if ((gs_tilt & 0x03) == 0x01)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_FRONT);
+    }
+    if ((gs_tilt & 0x03) == 0x02)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_BACK);
+    }
+    pola = (uint8_t)((gs_tilt >> 2) & 0x07);
+    if (pola == 0x01)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_LEFT);
+    }
+    if (pola == 0x02)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_RIGHT);
+    }
+    if (pola == 0x05)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_DOWN);
+    }
+    if (pola == 0x06)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_UP);
+    }
+    if ((gs_tilt & (1 << 5)) != 0)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_TAP);
+    }
+    if ((gs_tilt & (1 << 6)) != 0)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_UPDATE);
+    }
+    if ((gs_tilt & (1 << 7)) != 0)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_SHAKE);
+    }
+    if ((gs_srst & (1 << 0)) != 0)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_AUTO_SLEEP);
+    }
+    if ((gs_srst & (1 << 1)) != 0)
+    {
+        mask |= MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_AUTO_WAKE_UP);
+    }
+    
+    /* check every field */
+    if ((event->mask != mask) ||
+        ((uint8_t)event->bafro != (gs_tilt & 0x03)) ||
+        ((uint8_t)event->pola != pola) ||
+        ((uint8_t)event->tap != ((gs_tilt >> 5) & 0x01)) ||
+        ((uint8_t)event->alert != ((gs_tilt >> 6) & 0x01)) ||
+        ((uint8_t)event->shake != ((gs_tilt >> 7) & 0x01)) ||
+        ((uint8_t)event->auto_sleep != ((gs_srst >> 0) & 0x01)) ||
+        ((uint8_t)event->auto_wake_up != ((gs_srst >> 1) & 0x01)))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: tilt 0x%02X srst 0x%02X decoded as mask 0x%04X, expect 0x%04X.\n", 
+                                        gs_tilt, gs_srst, event->mask, mask);
+        gs_error = 1;
+    }
+    gs_mask |= event->mask;
+    gs_callback++;
+}
+
+/**
+ * @brief      run the virtual clock and serve the interrupt
+ * @param[in]  ms time in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 irq handler failed
+ * @note       the active high interrupt pin is polled every 1ms
+ */
+static uint8_t a_sim_run_ms(uint32_t ms)
+{
+    uint32_t i;
+    uint8_t level;
+    
+    for (i = 0; i < ms; i++)
+    {
+        (void)mma7660fc_sim_advance(&gs_sim, 1000);
+        (void)mma7660fc_sim_get_interrupt(&gs_sim, &level);
+        if (level != 0)
+        {
+            if (mma7660fc_irq_handler(&gs_handle) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     move to a new acceleration and collect the events
+ * @param[in] *mg pointer to an acceleration buffer
+ * @param[in] ms time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the collected mask and the callback counter are cleared before the run
+ */
+static uint8_t a_event_move(const int16_t mg[3], uint32_t ms)
+{
+    gs_mask = 0;
+    gs_callback = 0;
+    (void)mma7660fc_sim_set_accel(&gs_sim, mg);
+    
+    return a_sim_run_ms(ms);
+}
+
+/**
+ * @brief  event test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t mma7660fc_event_test(void)
+{
+    uint8_t res;
+    uint32_t i;
+    uint16_t orientation;
+    uint16_t flag;
+    mma7660fc_config_t config;
+    mma7660fc_info_t info;
+    static const int16_t flat[3] = {0, 0, 1000};
+    static const int16_t rotate[6][3] =
+    {
+        {1000, 0, 0}, {0, 0, -1000}, {0, 1000, 0}, {-1000, 0, 0}, {0, -1000, 0}, {0, 0, 1000},
+    };
+    static const int16_t tap[2][3] = {{-1200, 0, 1000}, {1200, 0, 1000}};
+    static const int16_t shake[3] = {2000, 0, 1000};
+    
+    /* get mma7660fc info */
+    res = mma7660fc_info(&info);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print mma7660fc */
+        mma7660fc_interface_debug_print("mma7660fc: chip is %s.\n", info.chip_name);
+        mma7660fc_interface_debug_print("mma7660fc: manufacturer is %s.\n", info.manufacturer_name);
+        mma7660fc_interface_debug_print("mma7660fc: interface is %s.\n", info.interface);
+        mma7660fc_interface_debug_print("mma7660fc: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        mma7660fc_interface_debug_print("mma7660fc: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        mma7660fc_interface_debug_print("mma7660fc: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        mma7660fc_interface_debug_print("mma7660fc: max current is %0.2fmA.\n", info.max_current_ma);
+        mma7660fc_interface_debug_print("mma7660fc: max temperature is %0.1fC.\n", info.temperature_max);
+        mma7660fc_interface_debug_print("mma7660fc: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start event test */
+    mma7660fc_interface_debug_print("mma7660fc: start event test.\n");
+    
+    /* link the simulated chip */
+    (void)mma7660fc_sim_init(&gs_sim);
+    mma7660fc_sim_bind(&gs_sim);
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_sim_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_sim_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, a_event_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_sim_iic_write);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_sim_delay_ms);
+    DRIVER_MMA7660FC_LINK_GET_TIME_MS(&gs_handle, mma7660fc_sim_get_time_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_EVENT_CALLBACK(&gs_handle, a_event_callback);
+    DRIVER_MMA7660FC_LINK_USER_DATA(&gs_handle, &gs_sim);
+    res = mma7660fc_init(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* every source enabled, 64 samples/s, the tap threshold above a 1g step */
+    memset(&config, 0, sizeof(mma7660fc_config_t));
+    config.front_back_interrupt = MMA7660FC_BOOL_TRUE;
+    config.up_down_right_left_interrupt = MMA7660FC_BOOL_TRUE;
+    config.tap_interrupt = MMA7660FC_BOOL_TRUE;
+    config.shake_x_interrupt = MMA7660FC_BOOL_TRUE;
+    config.shake_y_interrupt = MMA7660FC_BOOL_TRUE;
+    config.shake_z_interrupt = MMA7660FC_BOOL_TRUE;
+    config.mode = MMA7660FC_MODE_ACTIVE;
+    config.sleep_counter_prescaler = MMA7660FC_SLEEP_COUNTER_PRESCALER_1;
+    config.interrupt_pin_type = MMA7660FC_INTERRUPT_PIN_TYPE_PUSH_PULL;
+    config.interrupt_active_level = MMA7660FC_INTERRUPT_ACTIVE_LEVEL_HIGH;
+    config.tap_detection_rate = MMA7660FC_AUTO_SLEEP_RATE_64;
+    config.auto_wake_rate = MMA7660FC_AUTO_WAKE_RATE_8;
+    config.tilt_debounce_filter = MMA7660FC_TILT_DEBOUNCE_FILTER_DISABLE;
+    config.tap_detection_threshold = 31;
+    config.tap_x_detection = MMA7660FC_BOOL_TRUE;
+    config.tap_y_detection = MMA7660FC_BOOL_TRUE;
+    config.tap_z_detection = MMA7660FC_BOOL_TRUE;
+    res = mma7660fc_apply_config(&gs_handle, &config);
+    res |= a_event_move(flat, 100);
+    if ((res != 0) || (gs_error != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: config failed.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* a pola or bafro only change raises no tap or shake event */
+    orientation = MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_FRONT) | MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_BACK) |
+                  MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_LEFT) | MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_RIGHT) |
+                  MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_DOWN) | MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_UP);
+    for (i = 0; i < 6; i++)
+    {
+        res = a_event_move(rotate[i], 100);
+        if ((res != 0) || (gs_error != 0) || (gs_callback == 0) || ((gs_mask & (uint16_t)(~orientation)) != 0))
+        {
+            mma7660fc_interface_debug_print("mma7660fc: rotate %d check error, mask 0x%04X.\n", i, gs_mask);
+            (void)mma7660fc_deinit(&gs_handle);
+            
+            return 1;
+        }
+        mma7660fc_interface_debug_print("mma7660fc: rotate %d decoded as mask 0x%04X.\n", i, gs_mask);
+    }
+    
+    /* a pulse above the threshold is decoded as a tap */
+    flag = 0;
+    for (i = 0; i < 4; i++)
+    {
+        res = a_event_move(tap[i % 2], 16);
+        flag |= gs_mask;
+        if ((res != 0) || (gs_error != 0))
+        {
+            mma7660fc_interface_debug_print("mma7660fc: tap check error.\n");
+            (void)mma7660fc_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    res = a_event_move(flat, 100);
+    if ((res != 0) || (gs_error != 0) || ((flag & MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_TAP)) == 0) || 
+        ((flag & MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_SHAKE)) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: tap check error, mask 0x%04X.\n", flag);
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: tap decoded as mask 0x%04X.\n", flag);
+    
+    /* a shake is decoded as a shake */
+    res = a_event_move(shake, 100);
+    flag = gs_mask;
+    res |= a_event_move(flat, 100);
+    if ((res != 0) || (gs_error != 0) || ((flag & MMA7660FC_EVENT_MASK(MMA7660FC_STATUS_SHAKE)) == 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: shake check error, mask 0x%04X.\n", flag);
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: shake decoded as mask 0x%04X.\n", flag);
+    (void)mma7660fc_deinit(&gs_handle);
+    
+    /* finish event test */
+    mma7660fc_interface_debug_print("mma7660fc: finish event test.\n");
+    
+    return 0;
+}
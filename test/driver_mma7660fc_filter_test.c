@@ -0,0 +1,315 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_filter_test.c
+ * @brief     driver mma7660fc filter test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_filter_test.h"
+#include <math.h>
+#include <time.h>
+
+/**
+ * @brief filter test definition
+ */
+#define MMA7660FC_FILTER_TEST_SAMPLES        4096        /**< 4096 samples */
+#define MMA7660FC_FILTER_TEST_LOOPS          20          /**< 20 loops per time */
+
+/**
+ * @brief filter test case structure definition
+ */
+typedef struct filter_test_case_s
+{
+    const char *name;                  /**< case name */
+    mma7660fc_filter_type_t type;      /**< filter type */
+    uint8_t param;                     /**< length or shift */
+} filter_test_case_t;
+
+static int8_t gs_raw[MMA7660FC_FILTER_TEST_SAMPLES * 3];          /**< raw data */
+static int16_t gs_out[MMA7660FC_FILTER_TEST_SAMPLES * 3];         /**< fixed point output */
+static float gs_out_check[MMA7660FC_FILTER_TEST_SAMPLES * 3];     /**< float output */
+static const filter_test_case_t gs_case[] =
+{
+    {"boxcar 8", MMA7660FC_FILTER_TYPE_BOXCAR, 8},
+    {"boxcar 5", MMA7660FC_FILTER_TYPE_BOXCAR, 5},
+    {"iir 1/8", MMA7660FC_FILTER_TYPE_IIR, 3},
+    {"median 3", MMA7660FC_FILTER_TYPE_MEDIAN, 3},
+    {"median 5", MMA7660FC_FILTER_TYPE_MEDIAN, 5},
+};
+
+/**
+ * @brief      float reference filter
+ * @param[in]  *c pointer to a test case
+ * @param[in]  *raw pointer to a num * 3 raw data buffer
+ * @param[in]  num sample number
+ * @param[out] *out pointer to a num * 3 output buffer in count
+ * @note       the usual float smoothing, one loop per type, the history starts with the first sample
+ */
+static void a_filter_reference(const filter_test_case_t *c, const int8_t *raw, uint32_t num, float *out)
+{
+    uint32_t i;
+    uint8_t j;
+    uint8_t k;
+    uint8_t m;
+    uint8_t pos;
+    float history[3][16];
+    float state[3];
+    float w[5];
+    float a;
+    float t;
+    
+    for (j = 0; j < 3; j++)
+    {
+        for (k = 0; k < 16; k++)
+        {
+            history[j][k] = (float)raw[j];
+        }
+        state[j] = (c->type == MMA7660FC_FILTER_TYPE_BOXCAR) ? ((float)raw[j] * (float)c->param) : (float)raw[j];
+    }
+    pos = 0;
+    if (c->type == MMA7660FC_FILTER_TYPE_BOXCAR)
+    {
+        a = 1.0f / (float)c->param;
+        for (i = 0; i < num; i++)
+        {
+            for (j = 0; j < 3; j++)
+            {
+                state[j] += (float)raw[i * 3 + j] - history[j][pos];
+                history[j][pos] = (float)raw[i * 3 + j];
+                out[i * 3 + j] = state[j] * a;
+            }
+            pos = (uint8_t)((pos + 1 == c->param) ? 0 : (pos + 1));
+        }
+    }
+    else if (c->type == MMA7660FC_FILTER_TYPE_IIR)
+    {
+        a = 1.0f / (float)(1 << c->param);
+        for (i = 0; i < num; i++)
+        {
+            for (j = 0; j < 3; j++)
+            {
+                state[j] += ((float)raw[i * 3 + j] - state[j]) * a;
+                out[i * 3 + j] = state[j];
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i < num; i++)
+        {
+            for (j = 0; j < 3; j++)
+            {
+                history[j][pos] = (float)raw[i * 3 + j];
+                for (k = 0; k < c->param; k++)
+                {
+                    w[k] = history[j][k];
+                }
+                for (k = 1; k < c->param; k++)
+                {
+                    for (m = k; (m > 0) && (w[m - 1] > w[m]); m--)
+                    {
+                        t = w[m];
+                        w[m] = w[m - 1];
+                        w[m - 1] = t;
+                    }
+                }
+                out[i * 3 + j] = w[c->param / 2];
+            }
+            pos = (uint8_t)((pos + 1 == c->param) ? 0 : (pos + 1));
+        }
+    }
+}
+
+/**
+ * @brief     add a case stage
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] *c pointer to a test case
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      none
+ */
+static uint8_t a_filter_add(mma7660fc_filter_t *filter, const filter_test_case_t *c)
+{
+    if (c->type == MMA7660FC_FILTER_TYPE_BOXCAR)
+    {
+        return mma7660fc_filter_add_boxcar(filter, c->param);
+    }
+    else if (c->type == MMA7660FC_FILTER_TYPE_IIR)
+    {
+        return mma7660fc_filter_add_iir(filter, c->param);
+    }
+    else
+    {
+        return mma7660fc_filter_add_median(filter, c->param);
+    }
+}
+
+/**
+ * @brief     fixed point filter test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t mma7660fc_filter_test(uint32_t times)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t n;
+    uint32_t seed;
+    double err;
+    double ref_s;
+    double fixed_s;
+    double samples;
+    clock_t start;
+    mma7660fc_filter_t filter;
+    
+    /* start filter test */
+    mma7660fc_interface_debug_print("mma7660fc: start filter test.\n");
+    
+    /* make a slow tilt with +-2 count noise */
+    seed = 1;
+    for (i = 0; i < MMA7660FC_FILTER_TEST_SAMPLES; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            seed = seed * 1103515245U + 12345U;
+            gs_raw[i * 3 + j] = (int8_t)((int32_t)(((i >> 4) + j * 11) % 40) - 20 + 
+                                         (int32_t)((seed >> 16) % 5) - 2);
+        }
+    }
+    
+    /* check the invalid params */
+    (void)mma7660fc_filter_init(&filter);
+    if ((mma7660fc_filter_add_boxcar(&filter, 0) != 1) || (mma7660fc_filter_add_boxcar(&filter, 17) != 1) ||
+        (mma7660fc_filter_add_iir(&filter, 0) != 1) || (mma7660fc_filter_add_iir(&filter, 9) != 1) ||
+        (mma7660fc_filter_add_median(&filter, 4) != 1) || (mma7660fc_filter_add_median(NULL, 3) != 2) ||
+        (mma7660fc_filter_add_boxcar(&filter, 4) != 0) || (mma7660fc_filter_add_iir(&filter, 2) != 0) ||
+        (mma7660fc_filter_add_median(&filter, 3) != 0) || (mma7660fc_filter_add_median(&filter, 5) != 0) ||
+        (mma7660fc_filter_add_median(&filter, 3) != 1))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: param check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: param check ok.\n");
+    
+    samples = (double)times * MMA7660FC_FILTER_TEST_LOOPS * MMA7660FC_FILTER_TEST_SAMPLES;
+    for (n = 0; n < sizeof(gs_case) / sizeof(gs_case[0]); n++)
+    {
+        /* check the result against float */
+        (void)mma7660fc_filter_init(&filter);
+        if (a_filter_add(&filter, &gs_case[n]) != 0)
+        {
+            mma7660fc_interface_debug_print("mma7660fc: %s add failed.\n", gs_case[n].name);
+            
+            return 1;
+        }
+        (void)mma7660fc_filter_push_batch(&filter, gs_raw, MMA7660FC_FILTER_TEST_SAMPLES, gs_out);
+        mma7660fc_filter_reset(&filter);
+        for (i = 0; i < MMA7660FC_FILTER_TEST_SAMPLES; i++)
+        {
+            int16_t out[3];
+            
+            mma7660fc_filter_push(&filter, &gs_raw[i * 3], out);
+            if ((out[0] != gs_out[i * 3 + 0]) || (out[1] != gs_out[i * 3 + 1]) || (out[2] != gs_out[i * 3 + 2]))
+            {
+                mma7660fc_interface_debug_print("mma7660fc: %s push check error.\n", gs_case[n].name);
+                
+                return 1;
+            }
+        }
+        a_filter_reference(&gs_case[n], gs_raw, MMA7660FC_FILTER_TEST_SAMPLES, gs_out_check);
+        err = 0.0;
+        for (i = 0; i < MMA7660FC_FILTER_TEST_SAMPLES * 3; i++)
+        {
+            err = fmax(err, fabs((double)gs_out[i] / 256.0 - (double)gs_out_check[i]));
+        }
+        if (err > 1.0 / 256.0)
+        {
+            mma7660fc_interface_debug_print("mma7660fc: %s max error %0.4f count.\n", gs_case[n].name, err);
+            mma7660fc_interface_debug_print("mma7660fc: %s check error.\n", gs_case[n].name);
+            
+            return 1;
+        }
+        
+        /* float filter */
+        start = clock();
+        for (i = 0; i < times * MMA7660FC_FILTER_TEST_LOOPS; i++)
+        {
+            a_filter_reference(&gs_case[n], gs_raw, MMA7660FC_FILTER_TEST_SAMPLES, gs_out_check);
+        }
+        ref_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+        
+        /* fixed point filter */
+        start = clock();
+        for (i = 0; i < times * MMA7660FC_FILTER_TEST_LOOPS; i++)
+        {
+            (void)mma7660fc_filter_push_batch(&filter, gs_raw, MMA7660FC_FILTER_TEST_SAMPLES, gs_out);
+        }
+        fixed_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+        
+        /* output */
+        if ((ref_s > 0.0) && (fixed_s > 0.0))
+        {
+            mma7660fc_interface_debug_print("mma7660fc: %s max error %0.4f count, float %0.0f samples/s, fixed %0.0f samples/s, speedup %0.2f.\n",
+                                            gs_case[n].name, err, samples / ref_s, samples / fixed_s, ref_s / fixed_s);
+        }
+        else
+        {
+            mma7660fc_interface_debug_print("mma7660fc: run time is too short, increase the times.\n");
+        }
+    }
+    
+    /* median 5, boxcar 4 and iir 1/4 pipeline */
+    (void)mma7660fc_filter_init(&filter);
+    (void)mma7660fc_filter_add_median(&filter, 5);
+    (void)mma7660fc_filter_add_boxcar(&filter, 4);
+    (void)mma7660fc_filter_add_iir(&filter, 2);
+    start = clock();
+    for (i = 0; i < times * MMA7660FC_FILTER_TEST_LOOPS; i++)
+    {
+        (void)mma7660fc_filter_push_batch(&filter, gs_raw, MMA7660FC_FILTER_TEST_SAMPLES, gs_out);
+    }
+    fixed_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (fixed_s > 0.0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: median 5, boxcar 4 and iir 1/4 pipeline %0.0f samples/s.\n", samples / fixed_s);
+    }
+    
+    /* finish filter test */
+    mma7660fc_interface_debug_print("mma7660fc: finish filter test.\n");
+    
+    return 0;
+}
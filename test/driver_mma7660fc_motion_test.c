@@ -42,9 +42,10 @@ static volatile uint16_t gs_flag = 0;       /**< motion flag */
 /**
  * @brief     receive callback
  * @param[in] type irq type
+ * @param[in] *user_data pointer to the user data
  * @note      none
  */
-static void a_receive_callback(uint8_t type)
+static void a_receive_callback(uint8_t type, void *user_data)
 {
     switch (type)
     {
@@ -133,6 +134,26 @@ static void a_receive_callback(uint8_t type)
     }
 }
 
+/**
+ * @brief     event callback
+ * @param[in] *event pointer to an event structure
+ * @param[in] *user_data pointer to the user data
+ * @note      none
+ */
+static void a_event_callback(const mma7660fc_event_t *event, void *user_data)
+{
+    uint8_t i;
+    
+    /* one record per interrupt, print each set event */
+    for (i = MMA7660FC_STATUS_FRONT; i <= MMA7660FC_STATUS_AUTO_WAKE_UP; i++)
+    {
+        if ((event->mask & MMA7660FC_EVENT_MASK(i)) != 0)
+        {
+            a_receive_callback(i, user_data);
+        }
+    }
+}
+
 /**
  * @brief  motion test irq
  * @return status code
@@ -159,21 +180,41 @@ uint8_t mma7660fc_motion_test_irq_handler(void)
  * @note      none
  */
 uint8_t mma7660fc_motion_test(uint32_t timeout)
+{
+    mma7660fc_handle_t link;
+    
+    /* link interface function */
+    DRIVER_MMA7660FC_LINK_INIT(&link, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&link, mma7660fc_interface_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&link, mma7660fc_interface_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&link, mma7660fc_interface_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&link, mma7660fc_interface_iic_write);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&link, mma7660fc_interface_delay_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&link, mma7660fc_interface_debug_print);
+    
+    return mma7660fc_motion_test_with_link(&link, timeout);
+}
+
+/**
+ * @brief     motion test on the linked functions
+ * @param[in] *link pointer to a mma7660fc handle structure with the linked functions
+ * @param[in] timeout timeout in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the bus, delay and print functions of link are used, such as the bus simulator ones
+ */
+uint8_t mma7660fc_motion_test_with_link(const mma7660fc_handle_t *link, uint32_t timeout)
 {
     uint8_t res;
     uint8_t count;
     uint32_t i;
     mma7660fc_info_t info;
     
-    /* link interface function */
-    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
-    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_interface_iic_init);
-    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_interface_iic_deinit);
-    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_interface_iic_read);
-    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_interface_iic_write);
-    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_interface_delay_ms);
-    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
+    /* copy the linked functions */
+    gs_handle = *link;
     DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&gs_handle, a_receive_callback);
+    DRIVER_MMA7660FC_LINK_EVENT_CALLBACK(&gs_handle, a_event_callback);
     
     /* get mma7660fc info */
     res = mma7660fc_info(&info);
@@ -461,7 +502,7 @@ uint8_t mma7660fc_motion_test(uint32_t timeout)
         }
         
         /* delay 1ms */
-        mma7660fc_interface_delay_ms(1);
+        gs_handle.delay_ms(1);
     }
     
     /* finish motion test */
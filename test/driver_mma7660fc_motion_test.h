@@ -67,6 +67,17 @@ uint8_t mma7660fc_motion_test_irq_handler(void);
  */
 uint8_t mma7660fc_motion_test(uint32_t timeout);
 
+/**
+ * @brief     motion test on the linked functions
+ * @param[in] *link pointer to a mma7660fc handle structure with the linked functions
+ * @param[in] timeout timeout in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the bus, delay and print functions of link are used, such as the bus simulator ones
+ */
+uint8_t mma7660fc_motion_test_with_link(const mma7660fc_handle_t *link, uint32_t timeout);
+
 /**
  * @}
  */
@@ -36,7 +36,7 @@
 
 #include "driver_mma7660fc_read_test.h"
 
-static mma7660fc_handle_t gs_handle;        /**< mma7660fc handle */
+static mma7660fc_handle_t gs_handle;                   /**< mma7660fc handle */
 
 /**
  * @brief     read test
@@ -47,20 +47,43 @@ static mma7660fc_handle_t gs_handle;        /**< mma7660fc handle */
  * @note      none
  */
 uint8_t mma7660fc_read_test(uint32_t times)
+{
+    mma7660fc_handle_t link;
+    
+    /* link interface function */
+    DRIVER_MMA7660FC_LINK_INIT(&link, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&link, mma7660fc_interface_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&link, mma7660fc_interface_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&link, mma7660fc_interface_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&link, mma7660fc_interface_iic_write);
+    DRIVER_MMA7660FC_LINK_IIC_READ_VECTOR(&link, mma7660fc_interface_iic_read_vector);
+    DRIVER_MMA7660FC_LINK_IIC_READ_ASYNC(&link, mma7660fc_interface_iic_read_async);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&link, mma7660fc_interface_delay_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&link, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&link, mma7660fc_interface_receive_callback);
+    
+    return mma7660fc_read_test_with_link(&link, times);
+}
+
+/**
+ * @brief     read test on the linked functions
+ * @param[in] *link pointer to a mma7660fc handle structure with the linked functions
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the bus, delay and print functions of link are used, such as the bus simulator ones
+ */
+uint8_t mma7660fc_read_test_with_link(const mma7660fc_handle_t *link, uint32_t times)
 {
     uint8_t res;
     uint32_t i;
+    uint32_t j;
+    uint32_t counter;
     mma7660fc_info_t info;
     
-    /* link interface function */
-    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
-    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_interface_iic_init);
-    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_interface_iic_deinit);
-    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_interface_iic_read);
-    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_interface_iic_write);
-    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_interface_delay_ms);
-    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
-    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&gs_handle, mma7660fc_interface_receive_callback);
+    /* copy the linked functions */
+    gs_handle = *link;
     
     /* get mma7660fc info */
     res = mma7660fc_info(&info);
@@ -332,7 +355,7 @@ uint8_t mma7660fc_read_test(uint32_t times)
         float g[3];
         
         /* delay 1000ms */
-        mma7660fc_interface_delay_ms(1000);
+        gs_handle.delay_ms(1000);
         
         /* read data */
         res = mma7660fc_read(&gs_handle, raw, g);
@@ -348,6 +371,167 @@ uint8_t mma7660fc_read_test(uint32_t times)
         mma7660fc_interface_debug_print("mma7660fc: z is %0.2fg.\n", g[2]);
     }
     
+    /* read mg test */
+    mma7660fc_interface_debug_print("mma7660fc: read mg test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        int8_t raw[3];
+        int16_t mg[3];
+        
+        /* delay 1000ms */
+        gs_handle.delay_ms(1000);
+        
+        /* read data in mg */
+        res = mma7660fc_read_mg(&gs_handle, raw, mg);
+        if (res != 0)
+        {
+            mma7660fc_interface_debug_print("mma7660fc: read mg failed.\n");
+            (void)mma7660fc_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        mma7660fc_interface_debug_print("mma7660fc: x is %dmg.\n", mg[0]);
+        mma7660fc_interface_debug_print("mma7660fc: y is %dmg.\n", mg[1]);
+        mma7660fc_interface_debug_print("mma7660fc: z is %dmg.\n", mg[2]);
+    }
+    
+    /* alert retry test */
+    mma7660fc_interface_debug_print("mma7660fc: alert retry test.\n");
+    
+    /* set alert retry 3 */
+    res = mma7660fc_set_alert_retry(&gs_handle, 3);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set alert retry failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    
+    /* clear alert retry counter */
+    res = mma7660fc_clear_alert_retry_counter(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: clear alert retry counter failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    
+    for (i = 0; i < times; i++)
+    {
+        int8_t raw[3];
+        float g[3];
+        
+        /* delay 1000ms */
+        gs_handle.delay_ms(1000);
+        
+        /* read data */
+        res = mma7660fc_read(&gs_handle, raw, g);
+        if (res != 0)
+        {
+            mma7660fc_interface_debug_print("mma7660fc: read failed.\n");
+            (void)mma7660fc_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        mma7660fc_interface_debug_print("mma7660fc: x is %0.2fg.\n", g[0]);
+        mma7660fc_interface_debug_print("mma7660fc: y is %0.2fg.\n", g[1]);
+        mma7660fc_interface_debug_print("mma7660fc: z is %0.2fg.\n", g[2]);
+    }
+    
+    /* get alert retry counter */
+    res = mma7660fc_get_alert_retry_counter(&gs_handle, &counter);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get alert retry counter failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: alert retry counter is %d.\n", counter);
+    
+    /* read with state test */
+    mma7660fc_interface_debug_print("mma7660fc: read with state test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        int8_t raw[3];
+        float g[3];
+        mma7660fc_state_t state;
+        
+        /* delay 1000ms */
+        gs_handle.delay_ms(1000);
+        
+        /* read data with state */
+        res = mma7660fc_read_with_state(&gs_handle, raw, g, &state);
+        if (res != 0)
+        {
+            mma7660fc_interface_debug_print("mma7660fc: read with state failed.\n");
+            (void)mma7660fc_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        mma7660fc_interface_debug_print("mma7660fc: x is %0.2fg.\n", g[0]);
+        mma7660fc_interface_debug_print("mma7660fc: y is %0.2fg.\n", g[1]);
+        mma7660fc_interface_debug_print("mma7660fc: z is %0.2fg.\n", g[2]);
+        mma7660fc_interface_debug_print("mma7660fc: bafro is %d, pola is %d.\n", state.bafro, state.pola);
+        mma7660fc_interface_debug_print("mma7660fc: auto sleep is %d, auto wake up is %d.\n", state.auto_sleep, state.auto_wake_up);
+    }
+    
+    /* split-phase read test */
+    mma7660fc_interface_debug_print("mma7660fc: split-phase read test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        int8_t raw[3];
+        float g[3];
+        
+        /* delay 1000ms */
+        gs_handle.delay_ms(1000);
+        
+        /* start the read */
+        res = mma7660fc_read_start(&gs_handle);
+        if (res != 0)
+        {
+            mma7660fc_interface_debug_print("mma7660fc: read start failed.\n");
+            (void)mma7660fc_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        
+        /* wait for the completion */
+        for (j = 0; j < 100; j++)
+        {
+            res = mma7660fc_read_complete(&gs_handle, raw, g);
+            if (res != 5)
+            {
+                break;
+            }
+            
+            /* delay 1ms */
+            gs_handle.delay_ms(1);
+        }
+        if (res == 5)
+        {
+            mma7660fc_interface_debug_print("mma7660fc: read complete timeout.\n");
+            (void)mma7660fc_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        if (res != 0)
+        {
+            mma7660fc_interface_debug_print("mma7660fc: read complete failed.\n");
+            (void)mma7660fc_deinit(&gs_handle); 
+            
+            return 1;
+        }
+        mma7660fc_interface_debug_print("mma7660fc: x is %0.2fg.\n", g[0]);
+        mma7660fc_interface_debug_print("mma7660fc: y is %0.2fg.\n", g[1]);
+        mma7660fc_interface_debug_print("mma7660fc: z is %0.2fg.\n", g[2]);
+    }
+    
     /* finish read test */
     mma7660fc_interface_debug_print("mma7660fc: finish read test.\n");
     (void)mma7660fc_deinit(&gs_handle); 
@@ -58,6 +58,17 @@ extern "C"{
  */
 uint8_t mma7660fc_read_test(uint32_t times);
 
+/**
+ * @brief     read test on the linked functions
+ * @param[in] *link pointer to a mma7660fc handle structure with the linked functions
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the bus, delay and print functions of link are used, such as the bus simulator ones
+ */
+uint8_t mma7660fc_read_test_with_link(const mma7660fc_handle_t *link, uint32_t times);
+
 /**
  * @}
  */
@@ -47,6 +47,31 @@ static mma7660fc_handle_t gs_handle;        /**< mma7660fc handle */
  * @note   none
  */
 uint8_t mma7660fc_register_test(void)
+{
+    mma7660fc_handle_t link;
+    
+    /* link interface function */
+    DRIVER_MMA7660FC_LINK_INIT(&link, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&link, mma7660fc_interface_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&link, mma7660fc_interface_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&link, mma7660fc_interface_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&link, mma7660fc_interface_iic_write);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&link, mma7660fc_interface_delay_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&link, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&link, mma7660fc_interface_receive_callback);
+    
+    return mma7660fc_register_test_with_link(&link);
+}
+
+/**
+ * @brief     register test on the linked functions
+ * @param[in] *link pointer to a mma7660fc handle structure with the linked functions
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the bus, delay and print functions of link are used, such as the bus simulator ones
+ */
+uint8_t mma7660fc_register_test_with_link(const mma7660fc_handle_t *link)
 {
     uint8_t res;
     uint8_t status;
@@ -60,6 +85,8 @@ uint8_t mma7660fc_register_test(void)
     mma7660fc_bool_t enable;
     mma7660fc_mode_t mode;
     mma7660fc_info_t info;
+    mma7660fc_config_t config;
+    mma7660fc_config_t config_check;
     mma7660fc_sleep_counter_prescaler_t prescaler;
     mma7660fc_interrupt_pin_type_t type;
     mma7660fc_interrupt_active_level_t level;
@@ -67,15 +94,8 @@ uint8_t mma7660fc_register_test(void)
     mma7660fc_auto_wake_rate_t wake_rate;
     mma7660fc_tilt_debounce_filter_t filter;
     
-    /* link interface function */
-    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
-    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_interface_iic_init);
-    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_interface_iic_deinit);
-    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_interface_iic_read);
-    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_interface_iic_write);
-    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_interface_delay_ms);
-    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
-    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&gs_handle, mma7660fc_interface_receive_callback);
+    /* copy the linked functions */
+    gs_handle = *link;
     
     /* get mma7660fc info */
     res = mma7660fc_info(&info);
@@ -1412,6 +1432,197 @@ uint8_t mma7660fc_register_test(void)
     }
     mma7660fc_interface_debug_print("mma7660fc: check tap pulse debounce %0.2fms.\n", ms_check);
     
+    /* mma7660fc_set_shadow/mma7660fc_get_shadow test */
+    mma7660fc_interface_debug_print("mma7660fc: mma7660fc_set_shadow/mma7660fc_get_shadow test.\n");
+    
+    /* enable shadow */
+    res = mma7660fc_set_shadow(&gs_handle, MMA7660FC_BOOL_TRUE);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set shadow failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: enable shadow.\n");
+    res = mma7660fc_get_shadow(&gs_handle, &enable);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get shadow failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: check shadow %s.\n", enable == MMA7660FC_BOOL_TRUE ? "ok" : "error");
+    
+    /* standby only write with the shadow test */
+    mma7660fc_interface_debug_print("mma7660fc: standby only write with the shadow test.\n");
+    
+    res = mma7660fc_set_tap_detection_rate(&gs_handle, MMA7660FC_AUTO_SLEEP_RATE_120);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set tap detection rate failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    res = mma7660fc_set_mode(&gs_handle, MMA7660FC_MODE_ACTIVE);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set mode failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    res = mma7660fc_set_tap_detection_rate(&gs_handle, MMA7660FC_AUTO_SLEEP_RATE_1);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set tap detection rate failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: set tap detection rate 1 in active mode.\n");
+    res = mma7660fc_get_tap_detection_rate(&gs_handle, &sleep_rate);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get tap detection rate failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: check shadowed tap detection rate %s.\n", sleep_rate == MMA7660FC_AUTO_SLEEP_RATE_120 ? "ok" : "error");
+    res = mma7660fc_shadow_sync(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: shadow sync failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    res = mma7660fc_get_tap_detection_rate(&gs_handle, &sleep_rate);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get tap detection rate failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: check chip tap detection rate %s.\n", sleep_rate == MMA7660FC_AUTO_SLEEP_RATE_120 ? "ok" : "error");
+    res = mma7660fc_set_mode(&gs_handle, MMA7660FC_MODE_STANDBY);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set mode failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    
+    /* mma7660fc_shadow_invalidate/mma7660fc_shadow_sync test */
+    mma7660fc_interface_debug_print("mma7660fc: mma7660fc_shadow_invalidate/mma7660fc_shadow_sync test.\n");
+    
+    count = rand() % 256;
+    res = mma7660fc_set_sleep_count(&gs_handle, count);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set sleep count failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: set sleep count %d.\n", count);
+    res = mma7660fc_shadow_invalidate(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: shadow invalidate failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    res = mma7660fc_get_sleep_count(&gs_handle, &count_check);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get sleep count failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: check reloaded sleep count %s.\n", count == count_check ? "ok" : "error");
+    res = mma7660fc_shadow_sync(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: shadow sync failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    res = mma7660fc_get_sleep_count(&gs_handle, &count_check);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get sleep count failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: check synced sleep count %s.\n", count == count_check ? "ok" : "error");
+    
+    /* disable shadow */
+    res = mma7660fc_set_shadow(&gs_handle, MMA7660FC_BOOL_FALSE);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set shadow failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: disable shadow.\n");
+    res = mma7660fc_get_shadow(&gs_handle, &enable);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get shadow failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: check shadow %s.\n", enable == MMA7660FC_BOOL_FALSE ? "ok" : "error");
+    
+    /* mma7660fc_apply_config/mma7660fc_get_config test */
+    mma7660fc_interface_debug_print("mma7660fc: mma7660fc_apply_config/mma7660fc_get_config test.\n");
+    
+    res = mma7660fc_get_config(&gs_handle, &config);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get config failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    config.sleep_count = rand() % 256;
+    config.tap_detection_threshold = rand() % 32;
+    config.tap_pulse_debounce_count = rand() % 256;
+    config.tap_x_detection = (mma7660fc_bool_t)(rand() % 2);
+    config.shake_y_interrupt = (mma7660fc_bool_t)(rand() % 2);
+    config.tilt_debounce_filter = (mma7660fc_tilt_debounce_filter_t)(rand() % 8);
+    config.mode = MMA7660FC_MODE_STANDBY;
+    res = mma7660fc_apply_config(&gs_handle, &config);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: apply config failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: apply config.\n");
+    res = mma7660fc_get_config(&gs_handle, &config_check);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get config failed.\n");
+        (void)mma7660fc_deinit(&gs_handle); 
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: check config %s.\n", memcmp(&config, &config_check, sizeof(mma7660fc_config_t)) == 0 ? "ok" : "error");
+    
     /* finish register test */
     mma7660fc_interface_debug_print("mma7660fc: finish register test.\n");
     (void)mma7660fc_deinit(&gs_handle); 
@@ -59,6 +59,16 @@ extern "C"{
  */
 uint8_t mma7660fc_register_test(void);
 
+/**
+ * @brief     register test on the linked functions
+ * @param[in] *link pointer to a mma7660fc handle structure with the linked functions
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the bus, delay and print functions of link are used, such as the bus simulator ones
+ */
+uint8_t mma7660fc_register_test_with_link(const mma7660fc_handle_t *link);
+
 /**
  * @}
  */
@@ -0,0 +1,315 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_ring_test.c
+ * @brief     driver mma7660fc ring test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_ring_test.h"
+#include "driver_mma7660fc_sim.h"
+
+static mma7660fc_handle_t gs_handle;                   /**< mma7660fc handle */
+static mma7660fc_sim_t gs_sim;                         /**< simulated chip */
+static mma7660fc_ring_t gs_ring;                       /**< sample ring */
+static mma7660fc_ring_sample_t gs_ring_buffer[4];      /**< sample ring buffer */
+
+/**
+ * @brief     push a sample with a timestamp
+ * @param[in] timestamp sample timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 4 ring is full
+ * @note      none
+ */
+static uint8_t a_ring_push(uint32_t timestamp)
+{
+    mma7660fc_ring_sample_t sample;
+    
+    sample.timestamp = timestamp;
+    sample.raw[0] = (int8_t)timestamp;
+    sample.raw[1] = 0;
+    sample.raw[2] = 0;
+    sample.flags = 0;
+    
+    return mma7660fc_ring_push(&gs_ring, &sample);
+}
+
+/**
+ * @brief     pop and check the timestamps
+ * @param[in] max max sample number
+ * @param[in] *timestamp pointer to the expected timestamps
+ * @param[in] num expected sample number
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_ring_check(uint32_t max, const uint32_t *timestamp, uint32_t num)
+{
+    uint32_t i;
+    uint32_t n;
+    mma7660fc_ring_sample_t sample[4];
+    
+    if (mma7660fc_ring_pop(&gs_ring, sample, max, &n) != 0)
+    {
+        return 1;
+    }
+    if (n != num)
+    {
+        return 1;
+    }
+    for (i = 0; i < n; i++)
+    {
+        if ((sample[i].timestamp != timestamp[i]) || (sample[i].raw[0] != (int8_t)timestamp[i]))
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  ring test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t mma7660fc_ring_test(void)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t count;
+    uint32_t overflow;
+    uint32_t read_error;
+    int8_t raw[3];
+    int16_t mg[3];
+    int16_t ref[3];
+    mma7660fc_ring_sample_t sample;
+    mma7660fc_info_t info;
+    static const int16_t flat[3] = {0, 0, 1000};
+    static const uint32_t first[3] = {0, 1, 2};
+    static const uint32_t second[3] = {3, 6, 7};
+    static const uint32_t wrap[4] = {100, 101, 102, 103};
+    
+    /* get mma7660fc info */
+    res = mma7660fc_info(&info);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print mma7660fc */
+        mma7660fc_interface_debug_print("mma7660fc: chip is %s.\n", info.chip_name);
+        mma7660fc_interface_debug_print("mma7660fc: manufacturer is %s.\n", info.manufacturer_name);
+        mma7660fc_interface_debug_print("mma7660fc: interface is %s.\n", info.interface);
+        mma7660fc_interface_debug_print("mma7660fc: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        mma7660fc_interface_debug_print("mma7660fc: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        mma7660fc_interface_debug_print("mma7660fc: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        mma7660fc_interface_debug_print("mma7660fc: max current is %0.2fmA.\n", info.max_current_ma);
+        mma7660fc_interface_debug_print("mma7660fc: max temperature is %0.1fC.\n", info.temperature_max);
+        mma7660fc_interface_debug_print("mma7660fc: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start ring test */
+    mma7660fc_interface_debug_print("mma7660fc: start ring test.\n");
+    
+    /* null and size checks */
+    res = 0;
+    res |= (mma7660fc_ring_init(NULL, gs_ring_buffer, 4) != 2);
+    res |= (mma7660fc_ring_init(&gs_ring, NULL, 4) != 2);
+    res |= (mma7660fc_ring_init(&gs_ring, gs_ring_buffer, 3) != 1);
+    res |= (mma7660fc_ring_init(&gs_ring, gs_ring_buffer, 0) != 1);
+    res |= (mma7660fc_ring_init(&gs_ring, gs_ring_buffer, 4) != 0);
+    res |= (mma7660fc_ring_push(NULL, &sample) != 2);
+    res |= (mma7660fc_ring_push(&gs_ring, NULL) != 2);
+    res |= (mma7660fc_ring_pop(NULL, &sample, 1, &count) != 2);
+    res |= (mma7660fc_ring_pop(&gs_ring, NULL, 1, &count) != 2);
+    res |= (mma7660fc_ring_pop(&gs_ring, &sample, 1, NULL) != 2);
+    res |= (mma7660fc_ring_count(NULL, &count) != 2);
+    res |= (mma7660fc_ring_count(&gs_ring, NULL) != 2);
+    res |= (mma7660fc_ring_get_counter(NULL, &overflow, &read_error) != 2);
+    res |= (mma7660fc_ring_get_counter(&gs_ring, NULL, &read_error) != 2);
+    res |= (mma7660fc_ring_get_counter(&gs_ring, &overflow, NULL) != 2);
+    res |= (mma7660fc_ring_read(&gs_handle, NULL, 0, mg) != 2);
+    res |= (mma7660fc_ring_add_read_error(NULL) != 2);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: null check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: null check ok.\n");
+    
+    /* a full ring drops the new samples */
+    for (i = 0; i < 6; i++)
+    {
+        res = a_ring_push(i);
+        if (res != ((i < 4) ? 0 : 4))
+        {
+            mma7660fc_interface_debug_print("mma7660fc: push check error.\n");
+            
+            return 1;
+        }
+    }
+    (void)mma7660fc_ring_count(&gs_ring, &count);
+    (void)mma7660fc_ring_get_counter(&gs_ring, &overflow, &read_error);
+    if ((count != 4) || (overflow != 2) || (read_error != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: overflow check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: overflow check ok.\n");
+    
+    /* pop in batches across the buffer end */
+    res = a_ring_check(3, first, 3);
+    res |= a_ring_push(6);
+    res |= a_ring_push(7);
+    res |= a_ring_check(4, second, 3);
+    (void)mma7660fc_ring_count(&gs_ring, &count);
+    if ((res != 0) || (count != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: order check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: order check ok.\n");
+    
+    /* the free running counters wrap at 2^32 */
+    gs_ring.head = 0xFFFFFFFEU;
+    gs_ring.tail = 0xFFFFFFFEU;
+    res = 0;
+    for (i = 0; i < 5; i++)
+    {
+        res |= (a_ring_push(100 + i) != ((i < 4) ? 0 : 4));
+    }
+    (void)mma7660fc_ring_count(&gs_ring, &count);
+    res |= (count != 4);
+    res |= a_ring_check(4, wrap, 4);
+    if ((res != 0) || (gs_ring.head != 2))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: counter wrap check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: counter wrap check ok.\n");
+    
+    /* read through the simulated chip */
+    (void)mma7660fc_sim_init(&gs_sim);
+    mma7660fc_sim_bind(&gs_sim);
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_sim_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_sim_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_sim_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, mma7660fc_sim_iic_write);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_sim_delay_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_RECEIVE_CALLBACK(&gs_handle, mma7660fc_interface_receive_callback);
+    DRIVER_MMA7660FC_LINK_USER_DATA(&gs_handle, &gs_sim);
+    res = mma7660fc_init(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: init failed.\n");
+        
+        return 1;
+    }
+    res = mma7660fc_set_mode(&gs_handle, MMA7660FC_MODE_ACTIVE);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: set mode failed.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_sim_delay_ms(100);
+    
+    /* ring read returns the mg of the pushed sample */
+    (void)mma7660fc_ring_init(&gs_ring, gs_ring_buffer, 4);
+    res = mma7660fc_read_mg(&gs_handle, raw, ref);
+    res |= mma7660fc_ring_read(&gs_handle, &gs_ring, 10, mg);
+    res |= mma7660fc_ring_pop(&gs_ring, &sample, 1, &count);
+    if ((res != 0) || (count != 1) || (sample.timestamp != 10) || 
+        (sample.raw[0] != raw[0]) || (sample.raw[1] != raw[1]) || (sample.raw[2] != raw[2]) ||
+        (mg[0] != ref[0]) || (mg[1] != ref[1]) || (mg[2] != ref[2]))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: ring read check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: ring read x is %dmg, y is %dmg, z is %dmg.\n", mg[0], mg[1], mg[2]);
+    
+    /* a full ring still returns the mg */
+    res = 0;
+    for (i = 0; i < 5; i++)
+    {
+        mg[2] = 0;
+        res |= (mma7660fc_ring_read(&gs_handle, &gs_ring, 20 + i, (i == 0) ? NULL : mg) != ((i < 4) ? 0 : 4));
+        res |= ((i != 0) && (mg[2] != ref[2]));
+    }
+    (void)mma7660fc_ring_get_counter(&gs_ring, &overflow, &read_error);
+    if ((res != 0) || (overflow != 1) || (read_error != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: ring full check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: ring full check ok.\n");
+    
+    /* a failed read only counts a read error, so does a failed read of another producer */
+    (void)mma7660fc_deinit(&gs_handle);
+    (void)mma7660fc_ring_pop(&gs_ring, gs_ring_buffer, 4, &count);
+    res = 0;
+    res |= (mma7660fc_ring_read(&gs_handle, &gs_ring, 30, NULL) != 1);
+    res |= (mma7660fc_ring_add_read_error(&gs_ring) != 0);
+    (void)mma7660fc_ring_get_counter(&gs_ring, &overflow, &read_error);
+    (void)mma7660fc_ring_count(&gs_ring, &count);
+    if ((res != 0) || (read_error != 2) || (overflow != 1) || (count != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: read error check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: read error check ok.\n");
+    
+    /* finish ring test */
+    mma7660fc_interface_debug_print("mma7660fc: finish ring test.\n");
+    
+    return 0;
+}
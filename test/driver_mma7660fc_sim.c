@@ -0,0 +1,800 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_sim.c
+ * @brief     driver mma7660fc sim source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_sim.h"
+#include <string.h>
+
+/**
+ * @brief sim chip definition
+ */
+#define MMA7660FC_SIM_ADDRESS          0x98        /**< iic device address */
+#define MMA7660FC_SIM_REG_NUM          11          /**< xout to pd */
+#define MMA7660FC_SIM_REG_TILT         0x03        /**< tilt register */
+#define MMA7660FC_SIM_REG_SRST         0x04        /**< srst register */
+#define MMA7660FC_SIM_REG_SPCNT        0x05        /**< spcnt register */
+#define MMA7660FC_SIM_REG_INTSU        0x06        /**< intsu register */
+#define MMA7660FC_SIM_REG_MODE         0x07        /**< mode register */
+#define MMA7660FC_SIM_REG_SR           0x08        /**< sr register */
+#define MMA7660FC_SIM_REG_PDET         0x09        /**< pdet register */
+#define MMA7660FC_SIM_REG_PD           0x0A        /**< pd register */
+#define MMA7660FC_SIM_SHAKE_COUNT      28          /**< 1.3g shake level in counts */
+#define MMA7660FC_SIM_BAFRO_COUNT      11          /**< 0.5g front back level in counts */
+#define MMA7660FC_SIM_LOCKOUT_COUNT    17          /**< 0.8g portrait landscape z lockout in counts */
+
+/**
+ * @brief active sample period table definition
+ */
+static const uint32_t gs_amsr_us[8] =
+{
+    8333, 15625, 31250, 62500, 125000, 250000, 500000, 1000000,
+};
+
+/**
+ * @brief auto wake sample period table definition
+ */
+static const uint32_t gs_awsr_us[4] =
+{
+    31250, 62500, 125000, 1000000,
+};
+
+static mma7660fc_sim_t *gs_bound = NULL;        /**< sim bound to the delay and time functions */
+
+/**
+ * @brief     check the sampling state
+ * @param[in] *sim pointer to a sim structure
+ * @return    1 if sampling, 0 if not
+ * @note      sampling needs the mode bit set and the test bit clear
+ */
+static uint8_t a_mma7660fc_sim_active(mma7660fc_sim_t *sim)
+{
+    return (uint8_t)((sim->reg[MMA7660FC_SIM_REG_MODE] & 0x05) == 0x01);
+}
+
+/**
+ * @brief     get the sample period
+ * @param[in] *sim pointer to a sim structure
+ * @return    sample period in us
+ * @note      the auto wake rate is used while the chip is in auto sleep
+ */
+static uint32_t a_mma7660fc_sim_period(mma7660fc_sim_t *sim)
+{
+    uint8_t sr;
+    
+    sr = sim->reg[MMA7660FC_SIM_REG_SR];                                                  /* get sr */
+    if (sim->sleeping != 0)                                                               /* if auto sleep */
+    {
+        return gs_awsr_us[(sr >> 3) & 0x03];                                              /* auto wake rate */
+    }
+    
+    return gs_amsr_us[sr & 0x07];                                                         /* active rate */
+}
+
+/**
+ * @brief      convert the input to codes
+ * @param[in]  *sim pointer to a sim structure
+ * @param[out] *code pointer to a code buffer
+ * @note       21.33 counts per g, rounded and saturated to -32 - 31
+ */
+static void a_mma7660fc_sim_convert(mma7660fc_sim_t *sim, int8_t code[3])
+{
+    uint8_t i;
+    int32_t v;
+    const int16_t *mg;
+    
+    mg = sim->accel;                                                                      /* constant input */
+    if (sim->trace != NULL)                                                               /* if trace */
+    {
+        while ((sim->trace_index + 1 < sim->trace_num) &&
+               ((uint32_t)(sim->now_us - sim->trace_start_us) >= 
+                sim->trace[sim->trace_index + 1].time_us))                                /* find the entry */
+        {
+            sim->trace_index++;                                                           /* next entry */
+        }
+        mg = sim->trace[sim->trace_index].mg;                                             /* trace input */
+    }
+    for (i = 0; i < 3; i++)
+    {
+        v = (int32_t)mg[i] * 32;                                                          /* 32 counts per 1.5g */
+        v = (v >= 0) ? ((v + 750) / 1500) : -((750 - v) / 1500);                          /* round */
+        if (v > 31)                                                                       /* check max */
+        {
+            v = 31;                                                                       /* saturate */
+        }
+        if (v < -32)                                                                      /* check min */
+        {
+            v = -32;                                                                      /* saturate */
+        }
+        code[i] = (int8_t)v;                                                              /* set the code */
+    }
+}
+
+/**
+ * @brief     get the orientation
+ * @param[in] *code pointer to a code buffer
+ * @return    pola and bafro bits of the tilt register
+ * @note      front and back above 0.5g on z, portrait and landscape by the larger of x and y
+ *            unless z is above the 0.8g lockout
+ */
+static uint8_t a_mma7660fc_sim_orientation(const int8_t code[3])
+{
+    uint8_t bafro;
+    uint8_t pola;
+    int8_t x;
+    int8_t y;
+    int8_t z;
+    
+    x = code[0];                                                                          /* get x */
+    y = code[1];                                                                          /* get y */
+    z = code[2];                                                                          /* get z */
+    bafro = 0;                                                                            /* unknown */
+    if (z >= MMA7660FC_SIM_BAFRO_COUNT)                                                   /* lying on the front */
+    {
+        bafro = 1;                                                                        /* front */
+    }
+    else if (z <= -MMA7660FC_SIM_BAFRO_COUNT)                                             /* lying on the back */
+    {
+        bafro = 2;                                                                        /* back */
+    }
+    else
+    {
+        
+    }
+    pola = 0;                                                                             /* unknown */
+    if ((z < MMA7660FC_SIM_LOCKOUT_COUNT) && (z > -MMA7660FC_SIM_LOCKOUT_COUNT) && 
+        ((x != 0) || (y != 0)))                                                           /* outside the lockout */
+    {
+        if (((x >= 0) ? x : -x) >= ((y >= 0) ? y : -y))                                   /* landscape */
+        {
+            pola = (x > 0) ? 1 : 2;                                                       /* left or right */
+        }
+        else                                                                              /* portrait */
+        {
+            pola = (y > 0) ? 5 : 6;                                                       /* down or up */
+        }
+    }
+    
+    return (uint8_t)((pola << 2) | bafro);                                                /* return the bits */
+}
+
+/**
+ * @brief     update the registers with one sample
+ * @param[in] *sim pointer to a sim structure
+ * @note      runs at each sample instant, the events follow the enabled sources of intsu
+ */
+static void a_mma7660fc_sim_sample(mma7660fc_sim_t *sim)
+{
+    uint8_t i;
+    uint8_t intsu;
+    uint8_t pdet;
+    uint8_t orientation;
+    uint8_t changed;
+    uint8_t shake;
+    uint8_t tap;
+    uint8_t sleep_event;
+    uint8_t fire;
+    uint16_t limit;
+    int8_t code[3];
+    int16_t hp;
+    
+    intsu = sim->reg[MMA7660FC_SIM_REG_INTSU];                                            /* get intsu */
+    pdet = sim->reg[MMA7660FC_SIM_REG_PDET];                                              /* get pdet */
+    a_mma7660fc_sim_convert(sim, code);                                                   /* get the codes */
+    if (sim->sampled == 0)                                                                /* first sample */
+    {
+        memcpy(sim->prev, code, 3);                                                       /* no high pass step */
+        sim->tilt_pending = (uint8_t)(sim->reg[MMA7660FC_SIM_REG_TILT] & 0x1F);           /* current orientation */
+        sim->sampled = 1;                                                                 /* flag sampled */
+    }
+    
+    shake = 0;                                                                            /* init 0 */
+    tap = 0;                                                                              /* init 0 */
+    for (i = 0; i < 3; i++)
+    {
+        sim->reg[i] = (uint8_t)code[i] & 0x3F;                                            /* update xout to zout */
+        if (((intsu & (0x80 >> i)) != 0) && 
+            ((code[i] >= MMA7660FC_SIM_SHAKE_COUNT) || (code[i] <= -MMA7660FC_SIM_SHAKE_COUNT)))
+        {
+            shake |= (uint8_t)(0x80 >> i);                                                /* shake on the axis */
+        }
+        hp = (int16_t)(code[i] - sim->prev[i]);                                           /* high pass */
+        if (((pdet & (0x20 << i)) == 0) && 
+            (((hp >= 0) ? hp : -hp) > (pdet & 0x1F)))                                     /* above the threshold */
+        {
+            tap = 1;                                                                      /* pulse on the axis */
+        }
+    }
+    memcpy(sim->prev, code, 3);                                                           /* save the codes */
+    if (tap != 0)                                                                         /* if pulse */
+    {
+        sim->tap_count++;                                                                 /* debounce */
+        tap = (uint8_t)(sim->tap_count > sim->reg[MMA7660FC_SIM_REG_PD]);                 /* check the count */
+        if (tap != 0)                                                                     /* if tap */
+        {
+            sim->tap_count = 0;                                                           /* restart */
+        }
+    }
+    else
+    {
+        sim->tap_count = 0;                                                               /* restart */
+    }
+    
+    changed = 0;                                                                          /* init 0 */
+    orientation = a_mma7660fc_sim_orientation(code);                                      /* get the orientation */
+    if (orientation != (sim->reg[MMA7660FC_SIM_REG_TILT] & 0x1F))                         /* if it moved */
+    {
+        if (orientation != sim->tilt_pending)                                             /* new candidate */
+        {
+            sim->tilt_pending = orientation;                                              /* save it */
+            sim->tilt_count = 0;                                                          /* restart */
+        }
+        sim->tilt_count++;                                                                /* debounce */
+        if (sim->tilt_count > ((sim->reg[MMA7660FC_SIM_REG_SR] >> 5) & 0x07))             /* filt + 1 samples */
+        {
+            changed = (uint8_t)(orientation ^ sim->reg[MMA7660FC_SIM_REG_TILT]) & 0x1F;   /* changed bits */
+            sim->reg[MMA7660FC_SIM_REG_TILT] = (uint8_t)((sim->reg[MMA7660FC_SIM_REG_TILT] & 0xE0) | 
+                                                         orientation);                    /* update the tilt */
+            sim->tilt_count = 0;                                                          /* restart */
+        }
+    }
+    else
+    {
+        sim->tilt_pending = orientation;                                                  /* stable */
+        sim->tilt_count = 0;                                                              /* restart */
+    }
+    if (tap != 0)                                                                         /* if tap */
+    {
+        sim->reg[MMA7660FC_SIM_REG_TILT] |= 1 << 5;                                       /* set tap */
+    }
+    if (shake != 0)                                                                       /* if shake */
+    {
+        sim->reg[MMA7660FC_SIM_REG_TILT] |= 1 << 7;                                       /* set shake */
+    }
+    
+    sleep_event = 0;                                                                      /* init 0 */
+    if (sim->sleeping == 0)                                                               /* if awake */
+    {
+        if ((sim->reg[MMA7660FC_SIM_REG_MODE] & (1 << 4)) != 0)                           /* auto sleep enabled */
+        {
+            limit = (sim->reg[MMA7660FC_SIM_REG_SPCNT] == 0) ? 256 : 
+                     sim->reg[MMA7660FC_SIM_REG_SPCNT];                                   /* get the count */
+            if ((sim->reg[MMA7660FC_SIM_REG_MODE] & (1 << 5)) != 0)                       /* prescaler 16 */
+            {
+                limit = (uint16_t)(limit * 16);                                           /* divide by 16 */
+            }
+            if ((tap != 0) || (shake != 0) || (changed != 0))                             /* activity */
+            {
+                sim->sleep_count = 0;                                                     /* restart */
+            }
+            else if (++sim->sleep_count >= limit)                                         /* count expired */
+            {
+                sim->sleeping = 1;                                                        /* enter auto sleep */
+                sim->sleep_count = 0;                                                     /* restart */
+                sim->reg[MMA7660FC_SIM_REG_SRST] |= 1 << 0;                               /* set amsrs */
+                sleep_event = 1;                                                          /* flag event */
+            }
+            else
+            {
+                
+            }
+        }
+    }
+    else
+    {
+        if (((sim->reg[MMA7660FC_SIM_REG_MODE] & (1 << 3)) != 0) &&                       /* auto wake enabled */
+            ((tap != 0) || (shake != 0) || (changed != 0)))                               /* and activity */
+        {
+            sim->sleeping = 0;                                                            /* wake up */
+            sim->reg[MMA7660FC_SIM_REG_SRST] |= 1 << 1;                                   /* set awsrs */
+            sleep_event = 1;                                                              /* flag event */
+        }
+    }
+    
+    fire = (uint8_t)((((changed & 0x03) != 0) && ((intsu & 0x01) != 0)) ||                /* front back */
+                     (((changed & 0x1C) != 0) && ((intsu & 0x02) != 0)) ||                /* portrait landscape */
+                     ((tap != 0) && ((intsu & 0x04) != 0)) ||                             /* tap */
+                     ((sleep_event != 0) && ((intsu & 0x08) != 0)) ||                     /* auto sleep wake */
+                     ((intsu & 0x10) != 0) ||                                             /* every update */
+                     (shake != 0));                                                       /* shake */
+    if (fire != 0)                                                                        /* if an event */
+    {
+        sim->interrupt = 1;                                                               /* assert */
+        sim->statistics.interrupt++;                                                      /* count it */
+    }
+    sim->last_sample_us = sim->now_us;                                                    /* save the time */
+    sim->statistics.sample++;                                                             /* count it */
+}
+
+/**
+ * @brief     run the virtual clock
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] us time in us
+ * @note      samples are taken at their own instants, the rate may change at each sample
+ */
+static void a_mma7660fc_sim_run(mma7660fc_sim_t *sim, uint32_t us)
+{
+    uint32_t until;
+    
+    until = sim->now_us + us;                                                             /* end time */
+    while ((a_mma7660fc_sim_active(sim) != 0) && 
+           ((int32_t)(until - sim->next_sample_us) >= 0))                                 /* sample instants */
+    {
+        sim->now_us = sim->next_sample_us;                                                /* go to the instant */
+        a_mma7660fc_sim_sample(sim);                                                      /* sample */
+        sim->next_sample_us = sim->now_us + a_mma7660fc_sim_period(sim);                  /* next instant */
+    }
+    sim->now_us = until;                                                                  /* go to the end */
+}
+
+/**
+ * @brief     write one register
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] reg register address
+ * @param[in] value register value
+ * @note      the write rules of the chip are applied
+ */
+static void a_mma7660fc_sim_write_reg(mma7660fc_sim_t *sim, uint8_t reg, uint8_t value)
+{
+    uint8_t active;
+    
+    active = a_mma7660fc_sim_active(sim);                                                 /* get the state */
+    if (reg == MMA7660FC_SIM_REG_MODE)                                                    /* mode is always writable */
+    {
+        sim->reg[MMA7660FC_SIM_REG_MODE] = value;                                         /* set mode */
+        if ((active == 0) && (a_mma7660fc_sim_active(sim) != 0))                          /* standby to active */
+        {
+            sim->sleeping = 0;                                                            /* start awake */
+            sim->sleep_count = 0;                                                         /* restart */
+            sim->tap_count = 0;                                                           /* restart */
+            sim->tilt_count = 0;                                                          /* restart */
+            sim->sampled = 0;                                                             /* prime again */
+            sim->next_sample_us = sim->now_us + a_mma7660fc_sim_period(sim);              /* first sample */
+        }
+        else if (a_mma7660fc_sim_active(sim) == 0)                                        /* standby */
+        {
+            sim->sleeping = 0;                                                            /* leave auto sleep */
+        }
+        else
+        {
+            
+        }
+    }
+    else if (reg >= MMA7660FC_SIM_REG_SPCNT)                                              /* spcnt to pd */
+    {
+        if (active != 0)                                                                  /* standby only */
+        {
+            sim->statistics.ignored_byte++;                                               /* dropped */
+            
+            return;                                                                       /* return */
+        }
+        sim->reg[reg] = value;                                                            /* set the register */
+    }
+    else if ((reg < MMA7660FC_SIM_REG_SRST) && 
+             ((sim->reg[MMA7660FC_SIM_REG_MODE] & (1 << 2)) != 0))                        /* test mode */
+    {
+        sim->reg[reg] = value;                                                            /* set the register */
+    }
+    else
+    {
+        sim->statistics.ignored_byte++;                                                   /* read only */
+    }
+}
+
+/**
+ * @brief     initialize the simulated chip
+ * @param[in] *sim pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      the clock, the input and the statistics are cleared and the chip is powered on
+ */
+uint8_t mma7660fc_sim_init(mma7660fc_sim_t *sim)
+{
+    if (sim == NULL)                                                                      /* check sim */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    memset(sim, 0, sizeof(mma7660fc_sim_t));                                              /* clear all */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     power cycle the simulated chip
+ * @param[in] *sim pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      all registers reset to 0 like a brown-out, the clock and the input are kept
+ */
+uint8_t mma7660fc_sim_power_cycle(mma7660fc_sim_t *sim)
+{
+    if (sim == NULL)                                                                      /* check sim */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    memset(sim->reg, 0, MMA7660FC_SIM_REG_NUM);                                           /* reset the registers */
+    memset(sim->prev, 0, 3);                                                              /* clear the codes */
+    sim->sampled = 0;                                                                     /* not sampled */
+    sim->tilt_pending = 0;                                                                /* unknown */
+    sim->tilt_count = 0;                                                                  /* clear */
+    sim->tap_count = 0;                                                                   /* clear */
+    sim->sleep_count = 0;                                                                 /* clear */
+    sim->sleeping = 0;                                                                    /* awake */
+    sim->interrupt = 0;                                                                   /* released */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set the bus timing
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] byte_us bus time per byte in us
+ * @param[in] alert_us update window after a sample in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      xout to tilt read inside the update window have the alert bit set
+ */
+uint8_t mma7660fc_sim_set_bus_timing(mma7660fc_sim_t *sim, uint32_t byte_us, uint32_t alert_us)
+{
+    if (sim == NULL)                                                                      /* check sim */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    sim->byte_us = byte_us;                                                               /* set the byte time */
+    sim->alert_us = alert_us;                                                             /* set the window */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set a constant acceleration
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] *mg pointer to an acceleration buffer in mg
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim or mg is NULL
+ * @note      any trace is dropped
+ */
+uint8_t mma7660fc_sim_set_accel(mma7660fc_sim_t *sim, const int16_t mg[3])
+{
+    if ((sim == NULL) || (mg == NULL))                                                    /* check sim and mg */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    memcpy(sim->accel, mg, sizeof(int16_t) * 3);                                          /* set the input */
+    sim->trace = NULL;                                                                    /* drop the trace */
+    sim->trace_num = 0;                                                                   /* clear */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set an acceleration trace
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] *trace pointer to a trace buffer
+ * @param[in] num trace length
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim or trace is NULL
+ *            - 3 num is 0
+ * @note      the trace starts now, the last entry holds after the end
+ */
+uint8_t mma7660fc_sim_set_trace(mma7660fc_sim_t *sim, const mma7660fc_sim_trace_t *trace, uint32_t num)
+{
+    if ((sim == NULL) || (trace == NULL))                                                 /* check sim and trace */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (num == 0)                                                                         /* check num */
+    {
+        return 3;                                                                         /* return error */
+    }
+    
+    sim->trace = trace;                                                                   /* set the trace */
+    sim->trace_num = num;                                                                 /* set the length */
+    sim->trace_index = 0;                                                                 /* first entry */
+    sim->trace_start_us = sim->now_us;                                                    /* starts now */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     advance the virtual clock
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] us time in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      every sample instant inside the step is processed
+ */
+uint8_t mma7660fc_sim_advance(mma7660fc_sim_t *sim, uint32_t us)
+{
+    if (sim == NULL)                                                                      /* check sim */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    a_mma7660fc_sim_run(sim, us);                                                         /* run the clock */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the virtual clock
+ * @param[in]  *sim pointer to a sim structure
+ * @param[out] *us pointer to a time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim or us is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_sim_get_time(mma7660fc_sim_t *sim, uint32_t *us)
+{
+    if ((sim == NULL) || (us == NULL))                                                    /* check sim and us */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    *us = sim->now_us;                                                                    /* get the time */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set the sim used by the delay and time functions
+ * @param[in] *sim pointer to a sim structure, NULL unbinds
+ * @note      none
+ */
+void mma7660fc_sim_bind(mma7660fc_sim_t *sim)
+{
+    gs_bound = sim;                                                                       /* set the bound sim */
+}
+
+/**
+ * @brief     sim delay
+ * @param[in] ms time in ms
+ * @note      link with DRIVER_MMA7660FC_LINK_DELAY_MS, the virtual clock of the bound sim runs instead of the host clock
+ */
+void mma7660fc_sim_delay_ms(uint32_t ms)
+{
+    (void)mma7660fc_sim_advance(gs_bound, ms * 1000);                                     /* run the virtual clock */
+}
+
+/**
+ * @brief  sim time
+ * @return virtual time in ms of the bound sim
+ * @note   link with DRIVER_MMA7660FC_LINK_GET_TIME_MS
+ */
+uint32_t mma7660fc_sim_get_time_ms(void)
+{
+    uint32_t us = 0;
+    
+    (void)mma7660fc_sim_get_time(gs_bound, &us);                                          /* get the virtual clock */
+    
+    return us / 1000;                                                                     /* convert to ms */
+}
+
+/**
+ * @brief      get the interrupt pin level
+ * @param[in]  *sim pointer to a sim structure
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim or level is NULL
+ * @note       the level follows the iah bit of the mode register
+ */
+uint8_t mma7660fc_sim_get_interrupt(mma7660fc_sim_t *sim, uint8_t *level)
+{
+    uint8_t iah;
+    
+    if ((sim == NULL) || (level == NULL))                                                 /* check sim and level */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    iah = (uint8_t)((sim->reg[MMA7660FC_SIM_REG_MODE] >> 7) & 0x01);                      /* get iah */
+    *level = (sim->interrupt != 0) ? iah : (uint8_t)(iah ^ 0x01);                         /* get the level */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *sim pointer to a sim structure
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim or statistics is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_sim_get_statistics(mma7660fc_sim_t *sim, mma7660fc_sim_statistics_t *statistics)
+{
+    if ((sim == NULL) || (statistics == NULL))                                            /* check sim and statistics */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    memcpy(statistics, &sim->statistics, sizeof(mma7660fc_sim_statistics_t));             /* copy the statistics */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     clear the statistics
+ * @param[in] *sim pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_sim_clear_statistics(mma7660fc_sim_t *sim)
+{
+    if (sim == NULL)                                                                      /* check sim */
+    {
+        return 2;                                                                         /* return error */
+    }
+    
+    memset(&sim->statistics, 0, sizeof(mma7660fc_sim_statistics_t));                      /* clear the statistics */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     sim iic init
+ * @param[in] *user_data pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 user_data is NULL
+ * @note      link with DRIVER_MMA7660FC_LINK_IIC_INIT and the sim as user data
+ */
+uint8_t mma7660fc_sim_iic_init(void *user_data)
+{
+    return (user_data == NULL) ? 1 : 0;                                                   /* check the sim */
+}
+
+/**
+ * @brief     sim iic deinit
+ * @param[in] *user_data pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 user_data is NULL
+ * @note      link with DRIVER_MMA7660FC_LINK_IIC_DEINIT and the sim as user data
+ */
+uint8_t mma7660fc_sim_iic_deinit(void *user_data)
+{
+    return (user_data == NULL) ? 1 : 0;                                                   /* check the sim */
+}
+
+/**
+ * @brief      sim iic read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *user_data pointer to a sim structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 nack
+ * @note       the register address auto increments and wraps from pd to xout,
+ *             reading tilt clears tap, shake and the interrupt, reading srst clears srst
+ */
+uint8_t mma7660fc_sim_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data)
+{
+    uint16_t i;
+    mma7660fc_sim_t *sim;
+    
+    sim = (mma7660fc_sim_t *)user_data;                                                   /* get the sim */
+    if ((sim == NULL) || (addr != MMA7660FC_SIM_ADDRESS) || 
+        (reg >= MMA7660FC_SIM_REG_NUM))                                                   /* check the transfer */
+    {
+        return 1;                                                                         /* nack */
+    }
+    
+    a_mma7660fc_sim_run(sim, sim->byte_us * 3);                                           /* address, register, address */
+    for (i = 0; i < len; i++)
+    {
+        a_mma7660fc_sim_run(sim, sim->byte_us);                                           /* one byte */
+        buf[i] = sim->reg[reg];                                                           /* get the register */
+        if ((reg <= MMA7660FC_SIM_REG_TILT) && (sim->sampled != 0) && 
+            ((uint32_t)(sim->now_us - sim->last_sample_us) < sim->alert_us))              /* inside the update */
+        {
+            buf[i] |= 1 << 6;                                                             /* set alert */
+            sim->statistics.alert++;                                                      /* count it */
+        }
+        if (reg == MMA7660FC_SIM_REG_TILT)                                                /* tilt read */
+        {
+            sim->reg[MMA7660FC_SIM_REG_TILT] &= (uint8_t)(~((1 << 7) | (1 << 5)));        /* clear shake and tap */
+            sim->interrupt = 0;                                                           /* release */
+        }
+        else if (reg == MMA7660FC_SIM_REG_SRST)                                           /* srst read */
+        {
+            sim->reg[MMA7660FC_SIM_REG_SRST] = 0;                                         /* clear srst */
+            sim->interrupt = 0;                                                           /* release */
+        }
+        else
+        {
+            
+        }
+        reg = (uint8_t)((reg + 1) % MMA7660FC_SIM_REG_NUM);                               /* auto increment */
+    }
+    sim->statistics.read++;                                                               /* count it */
+    sim->statistics.read_byte += len;                                                     /* count the bytes */
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     sim iic write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *user_data pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 nack
+ * @note      mode is always writable, spcnt to pd only in standby, xout to tilt only in test mode,
+ *            dropped bytes are still acknowledged like the chip does
+ */
+uint8_t mma7660fc_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data)
+{
+    uint16_t i;
+    mma7660fc_sim_t *sim;
+    
+    sim = (mma7660fc_sim_t *)user_data;                                                   /* get the sim */
+    if ((sim == NULL) || (addr != MMA7660FC_SIM_ADDRESS) || 
+        (reg >= MMA7660FC_SIM_REG_NUM))                                                   /* check the transfer */
+    {
+        return 1;                                                                         /* nack */
+    }
+    
+    a_mma7660fc_sim_run(sim, sim->byte_us * 2);                                           /* address, register */
+    for (i = 0; i < len; i++)
+    {
+        a_mma7660fc_sim_run(sim, sim->byte_us);                                           /* one byte */
+        a_mma7660fc_sim_write_reg(sim, reg, buf[i]);                                      /* write the register */
+        reg = (uint8_t)((reg + 1) % MMA7660FC_SIM_REG_NUM);                               /* auto increment */
+    }
+    sim->statistics.write++;                                                              /* count it */
+    sim->statistics.write_byte += len;                                                    /* count the bytes */
+    
+    return 0;                                                                             /* success return 0 */
+}
@@ -0,0 +1,292 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_sim.h
+ * @brief     driver mma7660fc sim header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_SIM_H
+#define DRIVER_MMA7660FC_SIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup mma7660fc_test_driver
+ * @{
+ */
+
+/**
+ * @brief mma7660fc sim trace structure definition
+ * @note  sample and hold, time_us is relative to the mma7660fc_sim_set_trace call
+ */
+typedef struct mma7660fc_sim_trace_s
+{
+    uint32_t time_us;        /**< entry start time in us */
+    int16_t mg[3];           /**< x, y and z acceleration in mg */
+} mma7660fc_sim_trace_t;
+
+/**
+ * @brief mma7660fc sim statistics structure definition
+ */
+typedef struct mma7660fc_sim_statistics_s
+{
+    uint32_t read;                /**< read transactions */
+    uint32_t write;               /**< write transactions */
+    uint32_t read_byte;           /**< read data bytes */
+    uint32_t write_byte;          /**< written data bytes */
+    uint32_t ignored_byte;        /**< written bytes dropped by the write rules */
+    uint32_t alert;               /**< bytes read with the alert bit */
+    uint32_t sample;              /**< sample updates */
+    uint32_t interrupt;           /**< interrupt assertions */
+} mma7660fc_sim_statistics_t;
+
+/**
+ * @brief mma7660fc sim structure definition
+ */
+typedef struct mma7660fc_sim_s
+{
+    uint8_t reg[11];                                /**< xout to pd registers */
+    uint32_t now_us;                                /**< virtual clock in us */
+    uint32_t next_sample_us;                        /**< next sample time */
+    uint32_t last_sample_us;                        /**< last sample time */
+    uint32_t byte_us;                               /**< bus time per byte */
+    uint32_t alert_us;                              /**< update window after a sample */
+    const mma7660fc_sim_trace_t *trace;             /**< acceleration trace */
+    uint32_t trace_num;                             /**< trace length */
+    uint32_t trace_index;                           /**< current trace entry */
+    uint32_t trace_start_us;                        /**< trace start time */
+    int16_t accel[3];                               /**< acceleration without a trace in mg */
+    int8_t prev[3];                                 /**< previous codes */
+    uint8_t sampled;                                /**< at least one sample since active */
+    uint8_t tilt_pending;                           /**< pending orientation */
+    uint8_t tilt_count;                             /**< orientation debounce counter */
+    uint8_t tap_count;                              /**< tap debounce counter */
+    uint16_t sleep_count;                           /**< auto sleep counter */
+    uint8_t sleeping;                               /**< auto sleep state */
+    uint8_t interrupt;                              /**< interrupt asserted */
+    mma7660fc_sim_statistics_t statistics;          /**< bus and event statistics */
+} mma7660fc_sim_t;
+
+/**
+ * @brief     initialize the simulated chip
+ * @param[in] *sim pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      the clock, the input and the statistics are cleared and the chip is powered on
+ */
+uint8_t mma7660fc_sim_init(mma7660fc_sim_t *sim);
+
+/**
+ * @brief     power cycle the simulated chip
+ * @param[in] *sim pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      all registers reset to 0 like a brown-out, the clock and the input are kept
+ */
+uint8_t mma7660fc_sim_power_cycle(mma7660fc_sim_t *sim);
+
+/**
+ * @brief     set the bus timing
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] byte_us bus time per byte in us
+ * @param[in] alert_us update window after a sample in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      xout to tilt read inside the update window have the alert bit set
+ */
+uint8_t mma7660fc_sim_set_bus_timing(mma7660fc_sim_t *sim, uint32_t byte_us, uint32_t alert_us);
+
+/**
+ * @brief     set a constant acceleration
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] *mg pointer to an acceleration buffer in mg
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim or mg is NULL
+ * @note      any trace is dropped
+ */
+uint8_t mma7660fc_sim_set_accel(mma7660fc_sim_t *sim, const int16_t mg[3]);
+
+/**
+ * @brief     set an acceleration trace
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] *trace pointer to a trace buffer
+ * @param[in] num trace length
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim or trace is NULL
+ *            - 3 num is 0
+ * @note      the trace starts now, the last entry holds after the end
+ */
+uint8_t mma7660fc_sim_set_trace(mma7660fc_sim_t *sim, const mma7660fc_sim_trace_t *trace, uint32_t num);
+
+/**
+ * @brief     advance the virtual clock
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] us time in us
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      every sample instant inside the step is processed
+ */
+uint8_t mma7660fc_sim_advance(mma7660fc_sim_t *sim, uint32_t us);
+
+/**
+ * @brief      get the virtual clock
+ * @param[in]  *sim pointer to a sim structure
+ * @param[out] *us pointer to a time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim or us is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_sim_get_time(mma7660fc_sim_t *sim, uint32_t *us);
+
+/**
+ * @brief     set the sim used by the delay and time functions
+ * @param[in] *sim pointer to a sim structure, NULL unbinds
+ * @note      none
+ */
+void mma7660fc_sim_bind(mma7660fc_sim_t *sim);
+
+/**
+ * @brief     sim delay
+ * @param[in] ms time in ms
+ * @note      link with DRIVER_MMA7660FC_LINK_DELAY_MS, the virtual clock of the bound sim runs instead of the host clock
+ */
+void mma7660fc_sim_delay_ms(uint32_t ms);
+
+/**
+ * @brief  sim time
+ * @return virtual time in ms of the bound sim
+ * @note   link with DRIVER_MMA7660FC_LINK_GET_TIME_MS
+ */
+uint32_t mma7660fc_sim_get_time_ms(void);
+
+/**
+ * @brief      get the interrupt pin level
+ * @param[in]  *sim pointer to a sim structure
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim or level is NULL
+ * @note       the level follows the iah bit of the mode register
+ */
+uint8_t mma7660fc_sim_get_interrupt(mma7660fc_sim_t *sim, uint8_t *level);
+
+/**
+ * @brief      get the statistics
+ * @param[in]  *sim pointer to a sim structure
+ * @param[out] *statistics pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 sim or statistics is NULL
+ * @note       none
+ */
+uint8_t mma7660fc_sim_get_statistics(mma7660fc_sim_t *sim, mma7660fc_sim_statistics_t *statistics);
+
+/**
+ * @brief     clear the statistics
+ * @param[in] *sim pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 sim is NULL
+ * @note      none
+ */
+uint8_t mma7660fc_sim_clear_statistics(mma7660fc_sim_t *sim);
+
+/**
+ * @brief     sim iic init
+ * @param[in] *user_data pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 user_data is NULL
+ * @note      link with DRIVER_MMA7660FC_LINK_IIC_INIT and the sim as user data
+ */
+uint8_t mma7660fc_sim_iic_init(void *user_data);
+
+/**
+ * @brief     sim iic deinit
+ * @param[in] *user_data pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 user_data is NULL
+ * @note      link with DRIVER_MMA7660FC_LINK_IIC_DEINIT and the sim as user data
+ */
+uint8_t mma7660fc_sim_iic_deinit(void *user_data);
+
+/**
+ * @brief      sim iic read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *user_data pointer to a sim structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 nack
+ * @note       the register address auto increments and wraps from pd to xout,
+ *             reading tilt clears tap, shake and the interrupt, reading srst clears srst
+ */
+uint8_t mma7660fc_sim_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data);
+
+/**
+ * @brief     sim iic write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *user_data pointer to a sim structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 nack
+ * @note      mode is always writable, spcnt to pd only in standby, xout to tilt only in test mode,
+ *            dropped bytes are still acknowledged like the chip does
+ */
+uint8_t mma7660fc_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_sim_interface.c
+ * @brief     driver mma7660fc sim interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_sim_interface.h"
+
+/**
+ * @brief sim interface split-phase read structure definition
+ */
+typedef struct a_sim_interface_async_s
+{
+    mma7660fc_sim_t *sim;                               /**< simulated chip */
+    uint8_t addr;                                       /**< iic device address */
+    uint8_t reg;                                        /**< register address */
+    uint8_t *buf;                                       /**< data buffer */
+    uint16_t len;                                       /**< data length */
+    void (*done)(void *context, uint8_t status);        /**< completion function */
+    void *context;                                      /**< completion context */
+} a_sim_interface_async_t;
+
+static mma7660fc_sim_t *gs_sim;                         /**< bound simulated chip */
+static uint8_t (*gs_irq)(void);                         /**< simulated pin handler */
+static uint8_t gs_level;                                /**< simulated pin level */
+static a_sim_interface_async_t gs_async;                /**< pending split-phase read */
+static uint8_t gs_async_pending;                        /**< read pending flag */
+
+/**
+ * @brief     sim interface bind a simulated chip
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] *irq pointer to a pin handler, run on the falling edge of the simulated pin
+ * @note      delay runs on the virtual clock of sim and binds it for mma7660fc_sim_get_time_ms,
+ *            link the sim iic functions with sim as user data
+ */
+void mma7660fc_sim_interface_bind(mma7660fc_sim_t *sim, uint8_t (*irq)(void))
+{
+    gs_sim = sim;
+    gs_irq = irq;
+    gs_level = 1;
+    gs_async_pending = 0;
+    mma7660fc_sim_bind(sim);
+    if (sim != NULL)
+    {
+        (void)mma7660fc_sim_get_interrupt(sim, &gs_level);
+    }
+}
+
+/**
+ * @brief      sim interface iic bus vector read
+ * @param[in]  *vector pointer to a read vector array
+ * @param[in]  num number of the read vectors
+ * @param[in]  *user_data pointer to a sim structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       link with DRIVER_MMA7660FC_LINK_IIC_READ_VECTOR
+ */
+uint8_t mma7660fc_sim_interface_iic_read_vector(mma7660fc_iic_vector_t *vector, uint16_t num, void *user_data)
+{
+    uint16_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (mma7660fc_sim_iic_read(vector[i].addr, vector[i].reg, vector[i].buf, vector[i].len, user_data) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      sim interface iic bus split-phase read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function address
+ * @param[in]  *context pointer to the completion context
+ * @param[in]  *user_data pointer to a sim structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       one read at a time, it is completed by the next delay step
+ */
+uint8_t mma7660fc_sim_interface_iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                               void (*done)(void *context, uint8_t status), void *context, void *user_data)
+{
+    if ((user_data == NULL) || (gs_async_pending != 0))        /* one read at a time */
+    {
+        return 1;
+    }
+    
+    gs_async.sim = (mma7660fc_sim_t *)user_data;
+    gs_async.addr = addr;
+    gs_async.reg = reg;
+    gs_async.buf = buf;
+    gs_async.len = len;
+    gs_async.done = done;
+    gs_async.context = context;
+    gs_async_pending = 1;                                      /* completed by the next delay */
+    
+    return 0;
+}
+
+/**
+ * @brief     sim interface delay ms
+ * @param[in] ms time
+ * @note      runs 1ms steps, completes a pending split-phase read and serves the simulated pin
+ */
+void mma7660fc_sim_interface_delay_ms(uint32_t ms)
+{
+    uint8_t level;
+    uint8_t status;
+    
+    if (gs_sim == NULL)                                        /* check the bound sim */
+    {
+        return;
+    }
+    
+    while (ms != 0)
+    {
+        (void)mma7660fc_sim_advance(gs_sim, 1000);
+        ms--;
+        if (gs_async_pending != 0)                             /* complete the pending read */
+        {
+            gs_async_pending = 0;
+            status = mma7660fc_sim_iic_read(gs_async.addr, gs_async.reg, gs_async.buf, gs_async.len, gs_async.sim);
+            gs_async.done(gs_async.context, status);
+        }
+        (void)mma7660fc_sim_get_interrupt(gs_sim, &level);
+        if ((gs_level != 0) && (level == 0) && (gs_irq != NULL))  /* falling edge */
+        {
+            (void)gs_irq();
+            (void)mma7660fc_sim_get_interrupt(gs_sim, &level);
+        }
+        gs_level = level;
+    }
+}
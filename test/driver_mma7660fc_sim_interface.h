@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_sim_interface.h
+ * @brief     driver mma7660fc sim interface header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MMA7660FC_SIM_INTERFACE_H
+#define DRIVER_MMA7660FC_SIM_INTERFACE_H
+
+#include "driver_mma7660fc.h"
+#include "driver_mma7660fc_sim.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup mma7660fc_test_driver
+ * @{
+ */
+
+/**
+ * @brief     sim interface bind a simulated chip
+ * @param[in] *sim pointer to a sim structure
+ * @param[in] *irq pointer to a pin handler, run on the falling edge of the simulated pin
+ * @note      delay runs on the virtual clock of sim and binds it for mma7660fc_sim_get_time_ms,
+ *            link the sim iic functions with sim as user data
+ */
+void mma7660fc_sim_interface_bind(mma7660fc_sim_t *sim, uint8_t (*irq)(void));
+
+/**
+ * @brief      sim interface iic bus vector read
+ * @param[in]  *vector pointer to a read vector array
+ * @param[in]  num number of the read vectors
+ * @param[in]  *user_data pointer to a sim structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       link with DRIVER_MMA7660FC_LINK_IIC_READ_VECTOR
+ */
+uint8_t mma7660fc_sim_interface_iic_read_vector(mma7660fc_iic_vector_t *vector, uint16_t num, void *user_data);
+
+/**
+ * @brief      sim interface iic bus split-phase read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[in]  *done pointer to a completion function address
+ * @param[in]  *context pointer to the completion context
+ * @param[in]  *user_data pointer to a sim structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read start failed
+ * @note       one read at a time, it is completed by the next delay step
+ */
+uint8_t mma7660fc_sim_interface_iic_read_async(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len,
+                                               void (*done)(void *context, uint8_t status), void *context, void *user_data);
+
+/**
+ * @brief     sim interface delay ms
+ * @param[in] ms time
+ * @note      runs 1ms steps, completes a pending split-phase read and serves the simulated pin
+ */
+void mma7660fc_sim_interface_delay_ms(uint32_t ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
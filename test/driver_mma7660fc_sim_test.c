@@ -0,0 +1,625 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_sim_test.c
+ * @brief     driver mma7660fc sim test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_sim_test.h"
+#include "driver_mma7660fc_sim.h"
+#include <time.h>
+
+/**
+ * @brief sim test definition
+ */
+#define MMA7660FC_SIM_TEST_SPEED_SAMPLES        72000        /**< 10 minutes at 120 samples/s */
+
+static mma7660fc_handle_t gs_handle;                         /**< mma7660fc handle */
+static mma7660fc_sim_t gs_sim;                               /**< simulated chip */
+static uint32_t gs_count[MMA7660FC_EVENT_TYPE_NUM];          /**< event counters */
+static uint8_t gs_write_reg[16];                             /**< written register log */
+static uint8_t gs_write_data[16];                            /**< first written byte log */
+static uint8_t gs_write_num;                                 /**< write log length */
+
+/**
+ * @brief     iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] reg iic register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @param[in] *user_data pointer to user data
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the register and the first byte of every write are logged
+ */
+static uint8_t a_sim_iic_write(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len, void *user_data)
+{
+    if (gs_write_num < 16)
+    {
+        gs_write_reg[gs_write_num] = reg;
+        gs_write_data[gs_write_num] = buf[0];
+        gs_write_num++;
+    }
+    
+    return mma7660fc_sim_iic_write(addr, reg, buf, len, user_data);
+}
+
+/**
+ * @brief      check the write log
+ * @param[in]  *reg pointer to the expected registers
+ * @param[in]  num expected write number
+ * @return     status code
+ *             - 0 success
+ *             - 1 the log differs
+ * @note       mode writes are checked to leave active first and to come back last
+ */
+static uint8_t a_sim_check_write(const uint8_t *reg, uint8_t num)
+{
+    uint8_t i;
+    
+    if (gs_write_num != num)
+    {
+        return 1;
+    }
+    for (i = 0; i < num; i++)
+    {
+        if (gs_write_reg[i] != reg[i])
+        {
+            return 1;
+        }
+    }
+    if ((num > 1) && (gs_write_reg[0] == 0x07) && ((gs_write_data[0] & 0x07) != 0))
+    {
+        return 1;
+    }
+    if ((num > 1) && (gs_write_reg[num - 1] == 0x07) && ((gs_write_data[num - 1] & 0x07) == 0))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     event callback
+ * @param[in] *event pointer to an event structure
+ * @param[in] *user_data pointer to user data
+ * @note      the occurrences are counted per type
+ */
+static void a_event_callback(const mma7660fc_event_t *event, void *user_data)
+{
+    uint8_t i;
+    
+    (void)user_data;
+    for (i = 0; i < MMA7660FC_EVENT_TYPE_NUM; i++)
+    {
+        if ((event->mask & MMA7660FC_EVENT_MASK(i)) != 0)
+        {
+            gs_count[i] += event->count[i];
+        }
+    }
+}
+
+/**
+ * @brief      run the virtual clock and serve the interrupt
+ * @param[in]  ms time in ms
+ * @return     status code
+ *             - 0 success
+ *             - 1 irq handler failed
+ * @note       the active high interrupt pin is polled every 1ms
+ */
+static uint8_t a_sim_run_ms(uint32_t ms)
+{
+    uint32_t i;
+    uint8_t level;
+    
+    for (i = 0; i < ms; i++)
+    {
+        (void)mma7660fc_sim_advance(&gs_sim, 1000);
+        (void)mma7660fc_sim_get_interrupt(&gs_sim, &level);
+        if (level != 0)
+        {
+            if (mma7660fc_irq_handler(&gs_handle) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      get the default config
+ * @param[out] *config pointer to a config structure
+ * @note       active at 64 samples/s, all interrupts disabled, active high push-pull pin
+ */
+static void a_sim_default_config(mma7660fc_config_t *config)
+{
+    memset(config, 0, sizeof(mma7660fc_config_t));
+    config->mode = MMA7660FC_MODE_ACTIVE;
+    config->sleep_counter_prescaler = MMA7660FC_SLEEP_COUNTER_PRESCALER_1;
+    config->interrupt_pin_type = MMA7660FC_INTERRUPT_PIN_TYPE_PUSH_PULL;
+    config->interrupt_active_level = MMA7660FC_INTERRUPT_ACTIVE_LEVEL_HIGH;
+    config->tap_detection_rate = MMA7660FC_AUTO_SLEEP_RATE_64;
+    config->auto_wake_rate = MMA7660FC_AUTO_WAKE_RATE_8;
+    config->tilt_debounce_filter = MMA7660FC_TILT_DEBOUNCE_FILTER_DISABLE;
+    config->tap_detection_threshold = 31;
+    config->tap_x_detection = MMA7660FC_BOOL_FALSE;
+    config->tap_y_detection = MMA7660FC_BOOL_FALSE;
+    config->tap_z_detection = MMA7660FC_BOOL_FALSE;
+}
+
+/**
+ * @brief     apply a config and clear the counters
+ * @param[in] *config pointer to a config structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 apply failed
+ * @note      none
+ */
+static uint8_t a_sim_apply(const mma7660fc_config_t *config)
+{
+    if (mma7660fc_apply_config(&gs_handle, config) != 0)
+    {
+        return 1;
+    }
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    memset(gs_count, 0, sizeof(gs_count));
+    
+    return 0;
+}
+
+/**
+ * @brief  sim test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t mma7660fc_sim_test(void)
+{
+    uint8_t res;
+    uint8_t written;
+    uint8_t level;
+    uint8_t buf[11];
+    uint32_t i;
+    uint32_t sample;
+    uint32_t retry;
+    uint32_t invalid;
+    int8_t raw[3];
+    int16_t mg[3];
+    float g[3];
+    double host_s;
+    clock_t start;
+    mma7660fc_config_t config;
+    mma7660fc_snapshot_t snapshot;
+    mma7660fc_sim_statistics_t statistics;
+    mma7660fc_info_t info;
+    static const uint8_t sync_pdet[3] = {0x07, 0x09, 0x07};
+    static const uint8_t sync_spcnt_pd[4] = {0x07, 0x05, 0x0A, 0x07};
+    static const uint8_t sync_mode[1] = {0x07};
+    static const uint8_t sync_back[3] = {0x05, 0x09, 0x07};
+    static const uint8_t restore_order[3] = {0x07, 0x05, 0x07};
+    static const int16_t flat[3] = {0, 0, 1000};
+    static const int16_t left[3] = {1000, 0, 0};
+    static const int16_t shake[3] = {2000, 0, 1000};
+    static const mma7660fc_sim_trace_t rotate[4] =
+    {
+        {0, {0, 0, 1000}}, {200000, {1000, 0, 0}}, {400000, {0, -1000, 0}}, {600000, {0, 0, -1000}},
+    };
+    static const mma7660fc_sim_trace_t pulse[3] =
+    {
+        {0, {0, 0, 1000}}, {100000, {0, 0, 1500}}, {115625, {0, 0, 1000}},
+    };
+    
+    /* get mma7660fc info */
+    res = mma7660fc_info(&info);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print mma7660fc */
+        mma7660fc_interface_debug_print("mma7660fc: chip is %s.\n", info.chip_name);
+        mma7660fc_interface_debug_print("mma7660fc: manufacturer is %s.\n", info.manufacturer_name);
+        mma7660fc_interface_debug_print("mma7660fc: interface is %s.\n", info.interface);
+        mma7660fc_interface_debug_print("mma7660fc: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        mma7660fc_interface_debug_print("mma7660fc: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        mma7660fc_interface_debug_print("mma7660fc: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        mma7660fc_interface_debug_print("mma7660fc: max current is %0.2fmA.\n", info.max_current_ma);
+        mma7660fc_interface_debug_print("mma7660fc: max temperature is %0.1fC.\n", info.temperature_max);
+        mma7660fc_interface_debug_print("mma7660fc: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start sim test */
+    mma7660fc_interface_debug_print("mma7660fc: start sim test.\n");
+    
+    /* link the simulated chip */
+    (void)mma7660fc_sim_init(&gs_sim);
+    mma7660fc_sim_bind(&gs_sim);
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    DRIVER_MMA7660FC_LINK_INIT(&gs_handle, mma7660fc_handle_t); 
+    DRIVER_MMA7660FC_LINK_IIC_INIT(&gs_handle, mma7660fc_sim_iic_init);
+    DRIVER_MMA7660FC_LINK_IIC_DEINIT(&gs_handle, mma7660fc_sim_iic_deinit);
+    DRIVER_MMA7660FC_LINK_IIC_READ(&gs_handle, mma7660fc_sim_iic_read);
+    DRIVER_MMA7660FC_LINK_IIC_WRITE(&gs_handle, a_sim_iic_write);
+    DRIVER_MMA7660FC_LINK_DELAY_MS(&gs_handle, mma7660fc_sim_delay_ms);
+    DRIVER_MMA7660FC_LINK_GET_TIME_MS(&gs_handle, mma7660fc_sim_get_time_ms);
+    DRIVER_MMA7660FC_LINK_DEBUG_PRINT(&gs_handle, mma7660fc_interface_debug_print);
+    DRIVER_MMA7660FC_LINK_EVENT_CALLBACK(&gs_handle, a_event_callback);
+    DRIVER_MMA7660FC_LINK_USER_DATA(&gs_handle, &gs_sim);
+    res = mma7660fc_init(&gs_handle);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* register map */
+    buf[0] = 3;
+    buf[1] = 0x15;
+    res = mma7660fc_set_reg(&gs_handle, 0x0A, buf, 2);
+    res |= mma7660fc_get_reg(&gs_handle, 0x0A, buf, 2);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (buf[0] != 3) || (buf[1] != 0) || (statistics.ignored_byte != 1))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: auto increment check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: auto increment wraps from pd to xout, xout is read only.\n");
+    
+    /* config traffic */
+    a_sim_default_config(&config);
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    res = mma7660fc_apply_config(&gs_handle, &config);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (statistics.write_byte != 8))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: apply config check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    res = mma7660fc_sync_config(&gs_handle, &config, &written);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (written != 0) || (statistics.write_byte != 0) || (statistics.read != 1))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: sync config check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: apply config writes 8 bytes, sync config writes 0 bytes.\n");
+    
+    /* sync config writes only the changed registers */
+    config.tap_detection_threshold = 20;
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    gs_write_num = 0;
+    res = mma7660fc_sync_config(&gs_handle, &config, &written);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (written != 3) || (statistics.write_byte != 3) || (statistics.ignored_byte != 0) || 
+        (a_sim_check_write(sync_pdet, 3) != 0) || ((gs_write_data[1] & 0x1F) != 20))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: sync config pdet check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    config.sleep_count = 0x20;
+    config.tap_pulse_debounce_count = 0x10;
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    gs_write_num = 0;
+    res = mma7660fc_sync_config(&gs_handle, &config, &written);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (written != 4) || (statistics.write_byte != 4) || (statistics.ignored_byte != 0) || 
+        (a_sim_check_write(sync_spcnt_pd, 4) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: sync config spcnt pd check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    config.mode = MMA7660FC_MODE_STANDBY;
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    gs_write_num = 0;
+    res = mma7660fc_sync_config(&gs_handle, &config, &written);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (written != 1) || (statistics.write_byte != 1) || (a_sim_check_write(sync_mode, 1) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: sync config mode check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    a_sim_default_config(&config);
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    gs_write_num = 0;
+    res = mma7660fc_sync_config(&gs_handle, &config, &written);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (written != 4) || (statistics.write_byte != 4) || (statistics.ignored_byte != 0) || 
+        (a_sim_check_write(sync_back, 3) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: sync config back check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    mma7660fc_interface_debug_print("mma7660fc: sync config writes 3 bytes for pdet, 4 bytes for spcnt and pd, 1 byte for mode.\n");
+    
+    /* standby only writes */
+    buf[0] = 0x07;
+    res = mma7660fc_set_reg(&gs_handle, 0x08, buf, 1);
+    res |= mma7660fc_get_reg(&gs_handle, 0x08, buf, 1);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (buf[0] != (MMA7660FC_AUTO_SLEEP_RATE_64 | (MMA7660FC_AUTO_WAKE_RATE_8 << 3))) || (statistics.ignored_byte != 1))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: standby write check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: sr write in active mode is dropped.\n");
+    
+    /* tilt trace */
+    config.front_back_interrupt = MMA7660FC_BOOL_TRUE;
+    config.up_down_right_left_interrupt = MMA7660FC_BOOL_TRUE;
+    res = a_sim_apply(&config);
+    (void)mma7660fc_sim_set_trace(&gs_sim, rotate, 4);
+    res |= a_sim_run_ms(100);
+    res |= mma7660fc_read_mg(&gs_handle, raw, mg);
+    res |= a_sim_run_ms(700);
+    mma7660fc_interface_debug_print("mma7660fc: flat read x %d mg y %d mg z %d mg.\n", mg[0], mg[1], mg[2]);
+    mma7660fc_interface_debug_print("mma7660fc: front %d left %d up %d back %d events.\n", 
+                                    gs_count[MMA7660FC_STATUS_FRONT], gs_count[MMA7660FC_STATUS_LEFT],
+                                    gs_count[MMA7660FC_STATUS_UP], gs_count[MMA7660FC_STATUS_BACK]);
+    if ((res != 0) || (mg[0] != 0) || (mg[1] != 0) || (mg[2] < 953) || (mg[2] > 1047) ||
+        (gs_count[MMA7660FC_STATUS_FRONT] != 1) || (gs_count[MMA7660FC_STATUS_LEFT] != 1) ||
+        (gs_count[MMA7660FC_STATUS_UP] != 1) || (gs_count[MMA7660FC_STATUS_BACK] != 1) ||
+        (gs_count[MMA7660FC_STATUS_RIGHT] != 0) || (gs_count[MMA7660FC_STATUS_DOWN] != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: tilt trace check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: tilt trace check ok.\n");
+    
+    /* tilt debounce */
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    config.tilt_debounce_filter = MMA7660FC_TILT_DEBOUNCE_FILTER_8;
+    res = a_sim_apply(&config);
+    res |= a_sim_run_ms(200);
+    (void)mma7660fc_sim_set_accel(&gs_sim, left);
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    level = 0;
+    for (i = 0; (i < 1000) && (level == 0); i++)
+    {
+        (void)mma7660fc_sim_advance(&gs_sim, 1000);
+        (void)mma7660fc_sim_get_interrupt(&gs_sim, &level);
+    }
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    res |= mma7660fc_irq_handler(&gs_handle);
+    if ((res != 0) || (level == 0) || (statistics.sample != 8) || (gs_count[MMA7660FC_STATUS_LEFT] != 1))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: tilt debounce check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: tilt changes after %d samples.\n", statistics.sample);
+    
+    /* shake */
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    a_sim_default_config(&config);
+    config.shake_x_interrupt = MMA7660FC_BOOL_TRUE;
+    res = a_sim_apply(&config);
+    res |= a_sim_run_ms(100);
+    (void)mma7660fc_sim_set_accel(&gs_sim, shake);
+    res |= a_sim_run_ms(50);
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    res |= a_sim_run_ms(100);
+    if ((res != 0) || (gs_count[MMA7660FC_STATUS_SHAKE] == 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: shake check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: shake %d events.\n", gs_count[MMA7660FC_STATUS_SHAKE]);
+    
+    /* tap */
+    a_sim_default_config(&config);
+    config.tap_interrupt = MMA7660FC_BOOL_TRUE;
+    config.tap_detection_threshold = 5;
+    config.tap_z_detection = MMA7660FC_BOOL_TRUE;
+    config.tap_pulse_debounce_count = 1;
+    res = a_sim_apply(&config);
+    (void)mma7660fc_sim_set_trace(&gs_sim, pulse, 3);
+    res |= a_sim_run_ms(300);
+    if ((res != 0) || (gs_count[MMA7660FC_STATUS_TAP] != 1))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: tap check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: one sample pulse gives %d tap.\n", gs_count[MMA7660FC_STATUS_TAP]);
+    
+    /* alert */
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    a_sim_default_config(&config);
+    res = a_sim_apply(&config);
+    (void)mma7660fc_sim_set_bus_timing(&gs_sim, 25, 200);
+    invalid = 0;
+    for (retry = 0; retry < 4; retry += 3)
+    {
+        (void)mma7660fc_set_alert_retry(&gs_handle, (uint8_t)retry);
+        (void)mma7660fc_clear_alert_retry_counter(&gs_handle);
+        for (i = 0; i < ((retry == 0) ? 3 : 100); i++)
+        {
+            (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+            sample = statistics.sample;
+            while (statistics.sample == sample)
+            {
+                (void)mma7660fc_sim_advance(&gs_sim, 10);
+                (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+            }
+            if (mma7660fc_read(&gs_handle, raw, g) != 0)
+            {
+                invalid++;
+            }
+        }
+        if (retry == 0)
+        {
+            res |= (uint8_t)(invalid != 3);
+            invalid = 0;
+        }
+    }
+    (void)mma7660fc_get_alert_retry_counter(&gs_handle, &retry);
+    (void)mma7660fc_sim_set_bus_timing(&gs_sim, 0, 0);
+    if ((res != 0) || (invalid != 0) || (retry < 100))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: alert check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: reads right after the update need %d register retries for 100 samples.\n", retry);
+    
+    /* auto sleep and auto wake up */
+    config.sleep_count = 8;
+    config.auto_sleep = MMA7660FC_BOOL_TRUE;
+    config.auto_wake_up = MMA7660FC_BOOL_TRUE;
+    config.auto_sleep_interrupt = MMA7660FC_BOOL_TRUE;
+    res = a_sim_apply(&config);
+    res |= a_sim_run_ms(1000);
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    res |= a_sim_run_ms(1000);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    sample = statistics.sample;
+    (void)mma7660fc_sim_set_accel(&gs_sim, left);
+    res |= a_sim_run_ms(500);
+    if ((res != 0) || (gs_count[MMA7660FC_STATUS_AUTO_SLEEP] != 2) || 
+        (gs_count[MMA7660FC_STATUS_AUTO_WAKE_UP] != 1) || (sample != 8))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: auto sleep check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: auto sleep runs %d samples/s, wakes up on the tilt change and sleeps again.\n", sample);
+    
+    /* snapshot and restore */
+    (void)mma7660fc_sim_set_accel(&gs_sim, flat);
+    a_sim_default_config(&config);
+    res = a_sim_apply(&config);
+    res |= mma7660fc_snapshot(&gs_handle, &snapshot);
+    (void)mma7660fc_sim_power_cycle(&gs_sim);
+    res |= mma7660fc_get_reg(&gs_handle, 0x07, buf, 1);
+    (void)mma7660fc_sim_clear_statistics(&gs_sim);
+    gs_write_num = 0;
+    res |= mma7660fc_restore(&gs_handle, &snapshot);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    res |= mma7660fc_get_reg(&gs_handle, 0x05, &buf[1], 6);
+    mma7660fc_sim_delay_ms(100);
+    res |= mma7660fc_read_mg(&gs_handle, raw, mg);
+    if ((res != 0) || (buf[0] != 0) || (memcmp(&buf[1], snapshot.reg, 6) != 0) || 
+        (statistics.write != 3) || (statistics.read != 1) || (statistics.ignored_byte != 0) || 
+        (a_sim_check_write(restore_order, 3) != 0) || (mg[2] < 953))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: restore check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: restore after power cycle in %d writes and %d read.\n", 
+                                    statistics.write, statistics.read);
+    config.sleep_count = 0x20;
+    config.tap_detection_threshold = 10;
+    config.tap_pulse_debounce_count = 0x10;
+    res = a_sim_apply(&config);
+    gs_write_num = 0;
+    res |= mma7660fc_restore(&gs_handle, &snapshot);
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    res |= mma7660fc_get_reg(&gs_handle, 0x05, buf, 6);
+    if ((res != 0) || (memcmp(buf, snapshot.reg, 6) != 0) || (statistics.write != 3) || (statistics.read != 1) || 
+        (statistics.ignored_byte != 0) || (a_sim_check_write(restore_order, 3) != 0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: restore over active check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: restore over an active chip enters standby first and sets mode last.\n");
+    
+    /* faster than real time */
+    config.tap_detection_rate = MMA7660FC_AUTO_SLEEP_RATE_120;
+    res = a_sim_apply(&config);
+    (void)mma7660fc_sim_set_bus_timing(&gs_sim, 23, 0);
+    start = clock();
+    for (i = 0; i < MMA7660FC_SIM_TEST_SPEED_SAMPLES; i++)
+    {
+        (void)mma7660fc_sim_advance(&gs_sim, 8333);
+        res |= mma7660fc_read(&gs_handle, raw, g);
+    }
+    host_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    (void)mma7660fc_sim_get_statistics(&gs_sim, &statistics);
+    if ((res != 0) || (statistics.read != MMA7660FC_SIM_TEST_SPEED_SAMPLES) || 
+        (statistics.sample < MMA7660FC_SIM_TEST_SPEED_SAMPLES - 1))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: speed check error.\n");
+        (void)mma7660fc_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (host_s > 0.0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: 600s of 120 samples/s reads run in %0.3fs, %0.0f times real time.\n",
+                                        host_s, 600.0 / host_s);
+    }
+    (void)mma7660fc_deinit(&gs_handle);
+    
+    /* finish sim test */
+    mma7660fc_interface_debug_print("mma7660fc: finish sim test.\n");
+    
+    return 0;
+}
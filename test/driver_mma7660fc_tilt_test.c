@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mma7660fc_tilt_test.c
+ * @brief     driver mma7660fc tilt test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2025-03-31
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2025/03/31  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mma7660fc_tilt_test.h"
+#include <math.h>
+#include <time.h>
+
+/**
+ * @brief tilt test definition
+ */
+#define MMA7660FC_TILT_TEST_SAMPLES        4096        /**< 4096 samples */
+#define MMA7660FC_TILT_TEST_LOOPS          100         /**< 100 loops per time */
+#define MMA7660FC_TILT_TEST_MAX_ERROR      0.01        /**< max error in degree */
+
+static mma7660fc_tilt_t gs_tilt;                                  /**< tilt tables */
+static int8_t gs_raw[MMA7660FC_TILT_TEST_SAMPLES * 3];            /**< raw data */
+static int16_t gs_pitch[MMA7660FC_TILT_TEST_SAMPLES];             /**< table pitch */
+static int16_t gs_roll[MMA7660FC_TILT_TEST_SAMPLES];              /**< table roll */
+static float gs_pitch_check[MMA7660FC_TILT_TEST_SAMPLES];         /**< libm pitch */
+static float gs_roll_check[MMA7660FC_TILT_TEST_SAMPLES];          /**< libm roll */
+
+/**
+ * @brief      libm per-sample pitch and roll
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[out] *pitch pointer to a pitch buffer in degree
+ * @param[out] *roll pointer to a roll buffer in degree
+ * @note       the g of mma7660fc_read with atan2f
+ */
+static void a_tilt_reference(const int8_t raw[3], float *pitch, float *roll)
+{
+    float g[3];
+    
+    g[0] = (float)(raw[0] / 21.33f);
+    g[1] = (float)(raw[1] / 21.33f);
+    g[2] = (float)(raw[2] / 21.33f);
+    *pitch = atan2f(-g[0], sqrtf(g[1] * g[1] + g[2] * g[2])) * 57.2957795f;
+    *roll = atan2f(g[1], g[2]) * 57.2957795f;
+}
+
+/**
+ * @brief     get the angle error
+ * @param[in] a angle in degree
+ * @param[in] b angle in degree
+ * @return    error in degree
+ * @note      180 and -180 are the same angle
+ */
+static double a_tilt_error(double a, double b)
+{
+    double e;
+    
+    e = fabs(a - b);
+    if (e > 180.0)
+    {
+        e = 360.0 - e;
+    }
+    
+    return e;
+}
+
+/**
+ * @brief     table tilt test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+uint8_t mma7660fc_tilt_test(uint32_t times)
+{
+    uint8_t res;
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    uint32_t i;
+    uint32_t seed;
+    int8_t raw[3];
+    int16_t pitch;
+    int16_t roll;
+    float pitch_f;
+    float roll_f;
+    double table_error;
+    double libm_error;
+    double ref_s;
+    double table_s;
+    double samples;
+    clock_t start;
+    
+    /* start tilt test */
+    mma7660fc_interface_debug_print("mma7660fc: start tilt test.\n");
+    
+    /* build the tables */
+    res = mma7660fc_tilt_init(&gs_tilt);
+    if (res != 0)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: tilt init failed.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: tilt tables use %d bytes.\n", (int)sizeof(mma7660fc_tilt_t));
+    
+    /* check all codes against the double atan2 */
+    table_error = 0.0;
+    libm_error = 0.0;
+    for (x = -32; x < 32; x++)
+    {
+        for (y = -32; y < 32; y++)
+        {
+            for (z = -32; z < 32; z++)
+            {
+                double p;
+                double r;
+                
+                raw[0] = (int8_t)x;
+                raw[1] = (int8_t)y;
+                raw[2] = (int8_t)z;
+                mma7660fc_tilt_angle(&gs_tilt, raw, &pitch, &roll);
+                a_tilt_reference(raw, &pitch_f, &roll_f);
+                p = atan2(-(double)x, sqrt((double)(y * y + z * z))) * 57.29577951308232;
+                r = atan2((double)y, (double)z) * 57.29577951308232;
+                table_error = fmax(table_error, a_tilt_error((double)pitch / 100.0, p));
+                table_error = fmax(table_error, a_tilt_error((double)roll / 100.0, r));
+                libm_error = fmax(libm_error, a_tilt_error(pitch_f, p));
+                libm_error = fmax(libm_error, a_tilt_error(roll_f, r));
+            }
+        }
+    }
+    mma7660fc_interface_debug_print("mma7660fc: table max error %0.4f degree.\n", table_error);
+    mma7660fc_interface_debug_print("mma7660fc: libm float max error %0.4f degree.\n", libm_error);
+    if (table_error > MMA7660FC_TILT_TEST_MAX_ERROR)
+    {
+        mma7660fc_interface_debug_print("mma7660fc: angle check error.\n");
+        
+        return 1;
+    }
+    mma7660fc_interface_debug_print("mma7660fc: angle check ok.\n");
+    
+    /* make the samples */
+    seed = 1;
+    for (i = 0; i < MMA7660FC_TILT_TEST_SAMPLES * 3; i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        gs_raw[i] = (int8_t)((int32_t)((seed >> 16) & 0x3F) - 32);
+    }
+    
+    /* libm per-sample */
+    start = clock();
+    for (i = 0; i < times * MMA7660FC_TILT_TEST_LOOPS; i++)
+    {
+        uint32_t j;
+        
+        for (j = 0; j < MMA7660FC_TILT_TEST_SAMPLES; j++)
+        {
+            a_tilt_reference(&gs_raw[j * 3], &gs_pitch_check[j], &gs_roll_check[j]);
+        }
+    }
+    ref_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    
+    /* table batch */
+    start = clock();
+    for (i = 0; i < times * MMA7660FC_TILT_TEST_LOOPS; i++)
+    {
+        (void)mma7660fc_tilt_angle_batch(&gs_tilt, gs_raw, MMA7660FC_TILT_TEST_SAMPLES, gs_pitch, gs_roll);
+    }
+    table_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    
+    /* output */
+    samples = (double)times * MMA7660FC_TILT_TEST_LOOPS * MMA7660FC_TILT_TEST_SAMPLES;
+    if ((ref_s > 0.0) && (table_s > 0.0))
+    {
+        mma7660fc_interface_debug_print("mma7660fc: libm atan2f %0.0f samples/s.\n", samples / ref_s);
+        mma7660fc_interface_debug_print("mma7660fc: table %0.0f samples/s.\n", samples / table_s);
+        mma7660fc_interface_debug_print("mma7660fc: speedup %0.2f.\n", ref_s / table_s);
+    }
+    else
+    {
+        mma7660fc_interface_debug_print("mma7660fc: run time is too short, increase the times.\n");
+    }
+    
+    /* finish tilt test */
+    mma7660fc_interface_debug_print("mma7660fc: finish tilt test.\n");
+    
+    return 0;
+}